@@ -7,15 +7,16 @@ import (
 	"io"
 	"net/http"
 	"time"
+
+	"github.com/fentz26/neona/internal/apiclient"
 )
 
 // DefaultClientTimeout is the default timeout for API requests.
 const DefaultClientTimeout = 10 * time.Second
 
-// apiClient is the shared HTTP client with timeout.
-var apiClient = &http.Client{
-	Timeout: DefaultClientTimeout,
-}
+// apiClient is the shared HTTP client with timeout. It prefers the daemon's
+// unix socket when present and falls back to the --api TCP address.
+var apiClient = apiclient.New(DefaultClientTimeout)
 
 // apiGet performs a GET request to the API with timeout.
 func apiGet(path string) ([]byte, error) {
@@ -12,6 +12,7 @@ import (
 	"syscall"
 	"time"
 
+	"github.com/fentz26/neona/internal/apiclient"
 	"github.com/fentz26/neona/internal/audit"
 	"github.com/fentz26/neona/internal/connectors/localexec"
 	"github.com/fentz26/neona/internal/controlplane"
@@ -24,6 +25,7 @@ import (
 var (
 	listenAddr string
 	dbPath     string
+	socketPath string
 )
 
 var daemonCmd = &cobra.Command{
@@ -39,6 +41,7 @@ func init() {
 
 	daemonCmd.Flags().StringVar(&listenAddr, "listen", "127.0.0.1:7466", "Listen address for the API server")
 	daemonCmd.Flags().StringVar(&dbPath, "db", defaultDB, "Path to SQLite database")
+	daemonCmd.Flags().StringVar(&socketPath, "socket", apiclient.SocketPath(), "Unix socket path for the API server (empty to disable)")
 }
 
 // setupLogging configures logging to write to both stdout and a log file
@@ -90,10 +93,14 @@ func runDaemon(cmd *cobra.Command, args []string) error {
 	pdr := audit.NewPDRWriter(s)
 	workDir, _ := os.Getwd()
 	connector := localexec.New(workDir)
+	// Subtasks frequently repeat the same read-only git commands; serve
+	// those from the connector's short-TTL result cache
+	connector.EnableResultCache()
 
 	// Create service and server
 	service := controlplane.NewService(s, pdr, connector)
 	server := controlplane.NewServer(service, s, listenAddr)
+	server.SetSocketPath(socketPath)
 
 	// Create and start scheduler
 	schedulerCfg := scheduler.DefaultConfig()
@@ -117,6 +124,16 @@ func runDaemon(cmd *cobra.Command, args []string) error {
 	// Wire scheduler to server for /workers endpoint
 	server.SetScheduler(sched)
 
+	// Wake the scheduler as soon as tasks are created instead of waiting
+	// for the next poll tick
+	service.SetDispatchNotifier(sched)
+
+	// Fan task, worker, and lease events out to /events subscribers
+	events := controlplane.NewEventHub()
+	service.SetEventHub(events)
+	server.SetEventHub(events)
+	sched.SetEventSink(events)
+
 	sched.Start()
 	defer sched.Stop()
 
@@ -143,6 +160,7 @@ func runDaemon(cmd *cobra.Command, args []string) error {
 	case err := <-serverErr:
 		if err != nil {
 			log.Printf("Server error: %v", err)
+			pdr.Close()
 			s.Close()
 			return err
 		}
@@ -157,6 +175,9 @@ func runDaemon(cmd *cobra.Command, args []string) error {
 		log.Printf("HTTP server shutdown error: %v", err)
 	}
 
+	log.Println("Flushing audit records...")
+	pdr.Close()
+
 	log.Println("Closing database connection...")
 	if err := s.Close(); err != nil {
 		log.Printf("Database close error: %v", err)
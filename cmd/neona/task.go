@@ -3,10 +3,13 @@ package main
 import (
 	"encoding/json"
 	"fmt"
+	"io"
 	"os"
 	"strings"
 	"text/tabwriter"
+	"time"
 
+	"github.com/fentz26/neona/internal/apiclient"
 	"github.com/spf13/cobra"
 )
 
@@ -62,21 +65,33 @@ var taskLogCmd = &cobra.Command{
 	RunE:  runTaskLog,
 }
 
+var taskArchiveCmd = &cobra.Command{
+	Use:   "archive [task-id]",
+	Short: "Show an archived task from cold storage",
+	Args:  cobra.ExactArgs(1),
+	RunE:  runTaskArchive,
+}
+
 var (
-	taskTitle  string
-	taskDesc   string
-	taskStatus string
-	holderID   string
-	ttlSec     int
-	runCommand string
-	runArgs    string
+	taskTitle    string
+	taskDesc     string
+	taskPriority int
+	taskDeadline string
+	taskStatus   string
+	holderID     string
+	ttlSec       int
+	runCommand   string
+	runArgs      string
+	followLog    bool
 )
 
 func init() {
-	taskCmd.AddCommand(taskAddCmd, taskListCmd, taskShowCmd, taskClaimCmd, taskReleaseCmd, taskRunCmd, taskLogCmd)
+	taskCmd.AddCommand(taskAddCmd, taskListCmd, taskShowCmd, taskClaimCmd, taskReleaseCmd, taskRunCmd, taskLogCmd, taskArchiveCmd)
 
 	taskAddCmd.Flags().StringVar(&taskTitle, "title", "", "Task title (required)")
 	taskAddCmd.Flags().StringVar(&taskDesc, "desc", "", "Task description")
+	taskAddCmd.Flags().IntVar(&taskPriority, "priority", 0, "Task priority (higher is claimed first)")
+	taskAddCmd.Flags().StringVar(&taskDeadline, "deadline", "", "Optional deadline (RFC3339, e.g. 2026-01-02T15:04:05Z)")
 	taskAddCmd.MarkFlagRequired("title")
 
 	taskListCmd.Flags().StringVar(&taskStatus, "status", "", "Filter by status (pending, claimed, running, completed, failed)")
@@ -91,12 +106,22 @@ func init() {
 	taskRunCmd.Flags().StringVar(&holderID, "holder", defaultHolder, "Holder ID")
 	taskRunCmd.Flags().StringVar(&runCommand, "cmd", "", "Command to run (e.g., 'git status')")
 	taskRunCmd.MarkFlagRequired("cmd")
+
+	taskLogCmd.Flags().BoolVar(&followLog, "follow", false, "Stream the latest run's output live")
 }
 
 func runTaskAdd(cmd *cobra.Command, args []string) error {
-	body := map[string]string{
+	body := map[string]interface{}{
 		"title":       taskTitle,
 		"description": taskDesc,
+		"priority":    taskPriority,
+	}
+	if taskDeadline != "" {
+		deadline, err := time.Parse(time.RFC3339, taskDeadline)
+		if err != nil {
+			return fmt.Errorf("invalid deadline: %w", err)
+		}
+		body["deadline"] = deadline
 	}
 
 	resp, err := apiPost("/tasks", body)
@@ -245,6 +270,10 @@ func runTaskRun(cmd *cobra.Command, args []string) error {
 }
 
 func runTaskLog(cmd *cobra.Command, args []string) error {
+	if followLog {
+		return followTaskLog(args[0])
+	}
+
 	resp, err := apiGet("/tasks/" + args[0] + "/logs")
 	if err != nil {
 		return err
@@ -266,7 +295,21 @@ func runTaskLog(cmd *cobra.Command, args []string) error {
 		fmt.Printf("Command:   %s\n", run["command"])
 		fmt.Printf("Exit Code: %.0f\n", run["exit_code"].(float64))
 		fmt.Printf("Started:   %s\n", run["started_at"])
-		if stdout, ok := run["stdout"].(string); ok && stdout != "" {
+		stdout, _ := run["stdout"].(string)
+		if stdout == "" {
+			// Output is stored separately from run metadata; fetch it lazily
+			if id, ok := run["id"].(string); ok {
+				if logResp, err := apiGet("/runs/" + id + "/log"); err == nil {
+					var out struct {
+						Stdout string `json:"stdout"`
+					}
+					if json.Unmarshal(logResp, &out) == nil {
+						stdout = out.Stdout
+					}
+				}
+			}
+		}
+		if stdout != "" {
 			fmt.Println("Stdout:", truncate(stdout, 200))
 		}
 		fmt.Println()
@@ -274,6 +317,60 @@ func runTaskLog(cmd *cobra.Command, args []string) error {
 	return nil
 }
 
+func runTaskArchive(cmd *cobra.Command, args []string) error {
+	resp, err := apiGet("/tasks/" + args[0] + "/archive")
+	if err != nil {
+		return err
+	}
+
+	var record struct {
+		Task map[string]interface{}   `json:"task"`
+		Runs []map[string]interface{} `json:"runs"`
+	}
+	if err := json.Unmarshal(resp, &record); err != nil {
+		return err
+	}
+
+	task := record.Task
+	fmt.Printf("ID:          %s\n", task["id"])
+	fmt.Printf("Title:       %s\n", task["title"])
+	fmt.Printf("Status:      %s (archived)\n", task["status"])
+	fmt.Printf("Created:     %s\n", task["created_at"])
+	fmt.Printf("Updated:     %s\n", task["updated_at"])
+
+	if len(record.Runs) > 0 {
+		fmt.Println()
+		for i, run := range record.Runs {
+			fmt.Printf("=== Run %d ===\n", i+1)
+			fmt.Printf("Command:   %s\n", run["command"])
+			fmt.Printf("Exit Code: %.0f\n", run["exit_code"].(float64))
+			if stdout, ok := run["stdout"].(string); ok && stdout != "" {
+				fmt.Println("Stdout:", truncate(stdout, 200))
+			}
+		}
+	}
+	return nil
+}
+
+// followTaskLog tails the latest run's output live until the run ends.
+func followTaskLog(taskID string) error {
+	// Streaming responses need a client without a request timeout
+	client := apiclient.New(0)
+	resp, err := client.Get(apiAddr + "/tasks/" + taskID + "/logs?follow=1")
+	if err != nil {
+		return fmt.Errorf("API request failed: %w", err)
+	}
+	defer resp.Body.Close()
+
+	if resp.StatusCode >= 400 {
+		body, _ := io.ReadAll(resp.Body)
+		return fmt.Errorf("API error (%d): %s", resp.StatusCode, string(body))
+	}
+
+	_, err = io.Copy(os.Stdout, resp.Body)
+	return err
+}
+
 // --- Helpers ---
 
 func truncate(s string, n int) string {
@@ -6,9 +6,19 @@ import (
 	"os/exec"
 	"path/filepath"
 	"strings"
+	"sync"
 	"time"
 )
 
+const (
+	// scanCacheTTL is how long scan results are reused before tools are
+	// re-probed; installed agents don't appear or disappear second-to-second.
+	scanCacheTTL = 30 * time.Second
+	// scanWorkers bounds how many detectors probe concurrently, since
+	// several shell out to --version subprocesses.
+	scanWorkers = 4
+)
+
 // Agent represents an AI tool that can connect to Neona
 type Agent struct {
 	ID           string    `json:"id"`
@@ -21,9 +31,12 @@ type Agent struct {
 	AutoDetected bool      `json:"auto_detected"`
 }
 
-// Detector scans for installed AI tools
+// Detector scans for installed AI tools. It is safe for concurrent use
+// and caches scan results for scanCacheTTL.
 type Detector struct {
-	agents []Agent
+	mu        sync.Mutex
+	agents    []Agent
+	scannedAt time.Time
 }
 
 // NewDetector creates a new agent detector
@@ -31,50 +44,68 @@ func NewDetector() *Detector {
 	return &Detector{}
 }
 
-// Scan detects installed AI tools
+// Scan detects installed AI tools, returning the cached result when the
+// last scan is still fresh. Use Rescan to force re-detection.
 func (d *Detector) Scan() []Agent {
-	d.agents = []Agent{}
-
-	// Detect Cursor
-	if agent := d.detectCursor(); agent != nil {
-		d.agents = append(d.agents, *agent)
-	}
-
-	// Detect Claude CLI
-	if agent := d.detectClaudeCLI(); agent != nil {
-		d.agents = append(d.agents, *agent)
+	d.mu.Lock()
+	if !d.scannedAt.IsZero() && time.Since(d.scannedAt) < scanCacheTTL {
+		cached := d.agents
+		d.mu.Unlock()
+		return cached
 	}
+	d.mu.Unlock()
 
-	// Detect AntiGravity (Gemini CLI)
-	if agent := d.detectAntiGravity(); agent != nil {
-		d.agents = append(d.agents, *agent)
-	}
+	return d.Rescan()
+}
 
-	// Detect Zed
-	if agent := d.detectZed(); agent != nil {
-		d.agents = append(d.agents, *agent)
+// Rescan runs all detectors concurrently, ignoring and refreshing the
+// cache. Results keep a stable order regardless of which probe finishes
+// first.
+func (d *Detector) Rescan() []Agent {
+	detectors := []func() *Agent{
+		d.detectCursor,
+		d.detectClaudeCLI,
+		d.detectAntiGravity,
+		d.detectZed,
+		d.detectVSCodeCopilot,
+		d.detectWindsurf,
+		d.detectAider,
 	}
 
-	// Detect VS Code with Copilot
-	if agent := d.detectVSCodeCopilot(); agent != nil {
-		d.agents = append(d.agents, *agent)
+	results := make([]*Agent, len(detectors))
+	sem := make(chan struct{}, scanWorkers)
+	var wg sync.WaitGroup
+
+	for i, detect := range detectors {
+		wg.Add(1)
+		go func(i int, detect func() *Agent) {
+			defer wg.Done()
+			sem <- struct{}{}
+			defer func() { <-sem }()
+			results[i] = detect()
+		}(i, detect)
 	}
+	wg.Wait()
 
-	// Detect Windsurf
-	if agent := d.detectWindsurf(); agent != nil {
-		d.agents = append(d.agents, *agent)
+	found := []Agent{}
+	for _, agent := range results {
+		if agent != nil {
+			found = append(found, *agent)
+		}
 	}
 
-	// Detect Aider
-	if agent := d.detectAider(); agent != nil {
-		d.agents = append(d.agents, *agent)
-	}
+	d.mu.Lock()
+	d.agents = found
+	d.scannedAt = time.Now()
+	d.mu.Unlock()
 
-	return d.agents
+	return found
 }
 
 // GetAgents returns the detected agents
 func (d *Detector) GetAgents() []Agent {
+	d.mu.Lock()
+	defer d.mu.Unlock()
 	return d.agents
 }
 
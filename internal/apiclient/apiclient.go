@@ -0,0 +1,70 @@
+// Package apiclient provides the shared HTTP transport for Neona's
+// command-line clients. When the request targets the local daemon and its
+// unix domain socket is present, requests bypass the TCP stack entirely;
+// everything else dials the requested TCP address, so the same client works
+// against local and remote daemons.
+package apiclient
+
+import (
+	"context"
+	"net"
+	"net/http"
+	"os"
+	"path/filepath"
+	"time"
+)
+
+// SocketName is the daemon's unix socket file name inside ~/.neona.
+const SocketName = "neona.sock"
+
+// SocketPath returns the daemon's unix socket path (~/.neona/neona.sock),
+// or "" when the home directory cannot be resolved.
+func SocketPath() string {
+	homeDir, err := os.UserHomeDir()
+	if err != nil {
+		return ""
+	}
+	return filepath.Join(homeDir, ".neona", SocketName)
+}
+
+// New returns an http.Client that dials the daemon's unix socket for
+// loopback targets when the socket exists, and TCP otherwise. Only loopback
+// addresses take the socket fast-path: a client pointed at a remote daemon
+// must reach that daemon, not whatever is running locally. The socket check
+// happens per dial, so a daemon restarted with or without the socket is
+// picked up without recreating the client. A timeout of 0 means no timeout
+// (for long-lived streams).
+func New(timeout time.Duration) *http.Client {
+	socket := SocketPath()
+	dialer := &net.Dialer{Timeout: 5 * time.Second}
+
+	transport := &http.Transport{
+		DialContext: func(ctx context.Context, network, addr string) (net.Conn, error) {
+			if socket != "" && isLoopback(addr) {
+				if _, err := os.Stat(socket); err == nil {
+					if conn, err := dialer.DialContext(ctx, "unix", socket); err == nil {
+						return conn, nil
+					}
+					// Stale socket file from an unclean shutdown; use TCP
+				}
+			}
+			return dialer.DialContext(ctx, network, addr)
+		},
+	}
+
+	return &http.Client{Transport: transport, Timeout: timeout}
+}
+
+// isLoopback reports whether the dial target addresses the local machine
+// (localhost or a loopback IP), i.e. the daemon the unix socket belongs to.
+func isLoopback(addr string) bool {
+	host, _, err := net.SplitHostPort(addr)
+	if err != nil {
+		host = addr
+	}
+	if host == "localhost" {
+		return true
+	}
+	ip := net.ParseIP(host)
+	return ip != nil && ip.IsLoopback()
+}
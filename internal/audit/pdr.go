@@ -5,25 +5,142 @@ import (
 	"crypto/sha256"
 	"encoding/hex"
 	"encoding/json"
+	"log"
+	"sync"
+	"sync/atomic"
+	"time"
 
 	"github.com/fentz26/neona/internal/models"
 	"github.com/fentz26/neona/internal/store"
+	"github.com/google/uuid"
+)
+
+const (
+	// queueSize bounds the in-memory backlog of unwritten records.
+	queueSize = 1024
+	// maxBatch caps how many records a single multi-row INSERT covers.
+	maxBatch = 64
 )
 
 // PDRWriter writes Process Decision Records for audit trails.
+//
+// Records are queued in memory and drained by a background goroutine into
+// batched INSERTs, so callers on the dispatch hot path never wait for the
+// single-writer connection. When the queue is full the record is dropped
+// (audit is best-effort, dispatch latency is not).
 type PDRWriter struct {
 	store *store.Store
+
+	queue   chan models.PDREntry
+	flushCh chan chan struct{}
+	stop    chan struct{}
+	wg      sync.WaitGroup
+	dropped atomic.Int64
 }
 
-// NewPDRWriter creates a new PDR writer.
+// NewPDRWriter creates a new PDR writer and starts its background drainer.
 func NewPDRWriter(s *store.Store) *PDRWriter {
-	return &PDRWriter{store: s}
+	w := &PDRWriter{
+		store:   s,
+		queue:   make(chan models.PDREntry, queueSize),
+		flushCh: make(chan chan struct{}),
+		stop:    make(chan struct{}),
+	}
+	w.wg.Add(1)
+	go w.drainLoop()
+	return w
 }
 
-// Record writes a PDR entry for a state-mutating action.
+// Record queues a PDR entry for a state-mutating action. The entry is
+// returned immediately; the write happens asynchronously. If the queue is
+// full the record is dropped rather than blocking the caller.
 func (w *PDRWriter) Record(action string, inputs interface{}, outcome, taskID, details string) (*models.PDREntry, error) {
-	inputsHash := hashInputs(inputs)
-	return w.store.WritePDR(action, inputsHash, outcome, taskID, details)
+	pdr := &models.PDREntry{
+		ID:         uuid.New().String(),
+		Action:     action,
+		InputsHash: hashInputs(inputs),
+		Outcome:    outcome,
+		TaskID:     taskID,
+		Details:    details,
+		Timestamp:  time.Now().UTC(),
+	}
+
+	select {
+	case w.queue <- *pdr:
+	default:
+		if n := w.dropped.Add(1); n%100 == 1 {
+			log.Printf("pdr: queue full, dropped %d records so far", n)
+		}
+	}
+	return pdr, nil
+}
+
+// Flush blocks until every record queued before the call has been written.
+func (w *PDRWriter) Flush() {
+	done := make(chan struct{})
+	select {
+	case w.flushCh <- done:
+		<-done
+	case <-w.stop:
+		// Drainer already stopped; Close drained the queue.
+	}
+}
+
+// Close flushes remaining records and stops the background drainer.
+func (w *PDRWriter) Close() {
+	close(w.stop)
+	w.wg.Wait()
+}
+
+// drainLoop moves queued records into batched INSERTs until Close.
+func (w *PDRWriter) drainLoop() {
+	defer w.wg.Done()
+
+	for {
+		select {
+		case entry := <-w.queue:
+			w.writeBatch(entry)
+		case done := <-w.flushCh:
+			w.drainQueue()
+			close(done)
+		case <-w.stop:
+			w.drainQueue()
+			return
+		}
+	}
+}
+
+// writeBatch writes the given record plus any others already queued, up to
+// the batch cap, in one multi-row INSERT.
+func (w *PDRWriter) writeBatch(first models.PDREntry) {
+	batch := make([]models.PDREntry, 0, maxBatch)
+	batch = append(batch, first)
+	for len(batch) < maxBatch {
+		select {
+		case entry := <-w.queue:
+			batch = append(batch, entry)
+		default:
+			if err := w.store.WritePDRBatch(batch); err != nil {
+				log.Printf("pdr: batch write failed (%d records): %v", len(batch), err)
+			}
+			return
+		}
+	}
+	if err := w.store.WritePDRBatch(batch); err != nil {
+		log.Printf("pdr: batch write failed (%d records): %v", len(batch), err)
+	}
+}
+
+// drainQueue writes everything currently queued.
+func (w *PDRWriter) drainQueue() {
+	for {
+		select {
+		case entry := <-w.queue:
+			w.writeBatch(entry)
+		default:
+			return
+		}
+	}
 }
 
 // hashInputs creates a SHA256 hash of the inputs for reproducibility.
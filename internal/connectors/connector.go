@@ -23,3 +23,33 @@ type Connector interface {
 	// IsAllowed checks if a command is allowed to execute.
 	IsAllowed(cmd string, args []string) bool
 }
+
+// CapacityAware is implemented by connectors that manage their own weighted
+// concurrency slots (e.g. fewer heavyweight builds than cheap reads).
+// FreeSlots reports how many more commands the connector could start right
+// now; the scheduler caps dispatch at that in addition to its static
+// per-connector limit. Commands that still land on a saturated class queue
+// inside Execute until a slot frees or their context is cancelled.
+type CapacityAware interface {
+	Connector
+
+	// FreeSlots returns the number of commands the connector could start
+	// immediately across all command classes.
+	FreeSlots() int
+}
+
+// ChunkFunc receives one piece of live command output. stream is "stdout" or
+// "stderr"; data is only valid for the duration of the call.
+type ChunkFunc func(stream string, data []byte)
+
+// StreamingConnector is implemented by connectors that can emit output
+// incrementally while a command is still running. Callers that need live
+// output type-assert for it and fall back to Execute otherwise.
+type StreamingConnector interface {
+	Connector
+
+	// ExecuteStream runs a command, invoking onChunk for each piece of
+	// output as it is produced. The returned ExecResult still carries the
+	// full aggregated output.
+	ExecuteStream(ctx context.Context, cmd string, args []string, onChunk ChunkFunc) (*ExecResult, error)
+}
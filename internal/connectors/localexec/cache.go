@@ -0,0 +1,115 @@
+package localexec
+
+import (
+	"fmt"
+	"hash/fnv"
+	"os"
+	"path/filepath"
+	"strconv"
+	"strings"
+	"sync"
+	"time"
+
+	"github.com/fentz26/neona/internal/connectors"
+)
+
+// resultCacheTTL bounds how long a cached result can be served. The
+// fingerprint catches commits and staging; the TTL bounds staleness from
+// working-tree edits the fingerprint can't see.
+const resultCacheTTL = 5 * time.Second
+
+// readOnlyCommands lists the allowlisted invocations that never mutate
+// state and are therefore safe to cache. Write commands bypass the cache
+// and invalidate it wholesale.
+var readOnlyCommands = map[string]map[string]bool{
+	"git": {"status": true, "diff": true},
+}
+
+// isReadOnly reports whether the invocation is known side-effect free.
+func isReadOnly(cmd string, args []string) bool {
+	subcmds, ok := readOnlyCommands[cmd]
+	if !ok || len(args) == 0 {
+		return false
+	}
+	return subcmds[args[0]]
+}
+
+// resultCacheEntry is one stored ExecResult plus the state it was
+// computed against.
+type resultCacheEntry struct {
+	result      connectors.ExecResult
+	fingerprint string
+	expires     time.Time
+}
+
+// resultCache stores results of read-only commands keyed on
+// (command, args, workDir). Several subtasks inspecting the same repo
+// state run the identical git status/diff seconds apart; serving the
+// stored result skips the process spawn entirely.
+type resultCache struct {
+	mu      sync.Mutex
+	entries map[string]resultCacheEntry
+}
+
+func newResultCache() *resultCache {
+	return &resultCache{entries: make(map[string]resultCacheEntry)}
+}
+
+// cacheKey identifies an invocation against a working directory.
+func cacheKey(cmd string, args []string, workDir string) string {
+	return cmd + "\x00" + strings.Join(args, "\x00") + "\x00" + workDir
+}
+
+// get returns a copy of the stored result when it is fresh and was computed
+// against the same state fingerprint; nil otherwise.
+func (c *resultCache) get(key, fingerprint string) *connectors.ExecResult {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	entry, ok := c.entries[key]
+	if !ok {
+		return nil
+	}
+	if time.Now().After(entry.expires) || entry.fingerprint != fingerprint {
+		delete(c.entries, key)
+		return nil
+	}
+	result := entry.result
+	return &result
+}
+
+// put stores a successful result for the TTL window.
+func (c *resultCache) put(key, fingerprint string, result *connectors.ExecResult) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.entries[key] = resultCacheEntry{
+		result:      *result,
+		fingerprint: fingerprint,
+		expires:     time.Now().Add(resultCacheTTL),
+	}
+}
+
+// invalidate drops everything; called after any write command runs.
+func (c *resultCache) invalidate() {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+	c.entries = make(map[string]resultCacheEntry)
+}
+
+// stateFingerprint summarizes the working directory cheaply: size and mtime
+// of the git metadata files that change on commit and staging, plus the
+// directory itself. Three stat calls instead of a process spawn; anything
+// it can't observe is covered by the short TTL.
+func (l *LocalExec) stateFingerprint() string {
+	h := fnv.New64a()
+	for _, p := range []string{
+		l.workDir,
+		filepath.Join(l.workDir, ".git", "HEAD"),
+		filepath.Join(l.workDir, ".git", "index"),
+	} {
+		if info, err := os.Stat(p); err == nil {
+			fmt.Fprintf(h, "%s|%d|%d;", p, info.Size(), info.ModTime().UnixNano())
+		}
+	}
+	return strconv.FormatUint(h.Sum64(), 16)
+}
@@ -5,8 +5,10 @@ import (
 	"bytes"
 	"context"
 	"fmt"
+	"io"
 	"os/exec"
 	"strings"
+	"sync"
 
 	"github.com/fentz26/neona/internal/connectors"
 )
@@ -17,14 +19,62 @@ var allowedCommands = map[string][]string{
 	"git": {"diff", "status"},
 }
 
+// commandLimits caps concurrent executions per command class: a handful of
+// heavyweight go test runs, many cheap git reads. Commands beyond the limit
+// queue until a slot frees or their context is cancelled.
+var commandLimits = map[string]int{
+	"go":  2,
+	"git": 16,
+}
+
 // LocalExec implements the Connector interface for local command execution.
 type LocalExec struct {
 	workDir string
+	slots   map[string]chan struct{}
+	cache   *resultCache // nil unless EnableResultCache was called
 }
 
 // New creates a new LocalExec connector.
 func New(workDir string) *LocalExec {
-	return &LocalExec{workDir: workDir}
+	slots := make(map[string]chan struct{}, len(commandLimits))
+	for cmd, limit := range commandLimits {
+		slots[cmd] = make(chan struct{}, limit)
+	}
+	return &LocalExec{workDir: workDir, slots: slots}
+}
+
+// EnableResultCache turns on short-TTL caching of read-only command results;
+// see cache.go. Must be called before the connector is shared across
+// goroutines.
+func (l *LocalExec) EnableResultCache() {
+	l.cache = newResultCache()
+}
+
+// FreeSlots reports how many more commands could start immediately across
+// all command classes, implementing connectors.CapacityAware.
+func (l *LocalExec) FreeSlots() int {
+	free := 0
+	for _, sem := range l.slots {
+		free += cap(sem) - len(sem)
+	}
+	return free
+}
+
+// acquire takes a concurrency slot for cmd's class, blocking while the
+// class is saturated. The returned release must be called when the command
+// finishes. Commands without a configured class run unthrottled.
+func (l *LocalExec) acquire(ctx context.Context, cmd string) (func(), error) {
+	sem, ok := l.slots[cmd]
+	if !ok {
+		return func() {}, nil
+	}
+
+	select {
+	case sem <- struct{}{}:
+		return func() { <-sem }, nil
+	case <-ctx.Done():
+		return nil, ctx.Err()
+	}
 }
 
 // Name returns the connector identifier.
@@ -53,12 +103,30 @@ func (l *LocalExec) IsAllowed(cmd string, args []string) bool {
 	return false
 }
 
-// Execute runs a command if it's in the allowlist.
+// Execute runs a command if it's in the allowlist. With the result cache
+// enabled, repeated read-only invocations against unchanged state are
+// served from the cache without spawning a process.
 func (l *LocalExec) Execute(ctx context.Context, cmd string, args []string) (*connectors.ExecResult, error) {
 	if !l.IsAllowed(cmd, args) {
 		return nil, fmt.Errorf("command not allowed: %s %s", cmd, strings.Join(args, " "))
 	}
 
+	var key, fingerprint string
+	cacheable := l.cache != nil && isReadOnly(cmd, args)
+	if cacheable {
+		key = cacheKey(cmd, args, l.workDir)
+		fingerprint = l.stateFingerprint()
+		if result := l.cache.get(key, fingerprint); result != nil {
+			return result, nil
+		}
+	}
+
+	release, err := l.acquire(ctx, cmd)
+	if err != nil {
+		return nil, err
+	}
+	defer release()
+
 	execCmd := exec.CommandContext(ctx, cmd, args...)
 	if l.workDir != "" {
 		execCmd.Dir = l.workDir
@@ -68,7 +136,7 @@ func (l *LocalExec) Execute(ctx context.Context, cmd string, args []string) (*co
 	execCmd.Stdout = &stdout
 	execCmd.Stderr = &stderr
 
-	err := execCmd.Run()
+	err = execCmd.Run()
 
 	exitCode := 0
 	if err != nil {
@@ -79,11 +147,123 @@ func (l *LocalExec) Execute(ctx context.Context, cmd string, args []string) (*co
 		}
 	}
 
-	return &connectors.ExecResult{
+	result := &connectors.ExecResult{
 		Command:  cmd,
 		Args:     args,
 		ExitCode: exitCode,
 		Stdout:   stdout.String(),
 		Stderr:   stderr.String(),
-	}, nil
+	}
+
+	if cacheable {
+		l.cache.put(key, fingerprint, result)
+	} else if l.cache != nil {
+		// A command that may have written state ran; drop every cached result
+		l.cache.invalidate()
+	}
+	return result, nil
+}
+
+// ExecuteStream runs an allowlisted command, forwarding output to onChunk as
+// it is produced. The returned result carries the full aggregated output, so
+// callers that ignore onChunk get Execute's behavior.
+func (l *LocalExec) ExecuteStream(ctx context.Context, cmd string, args []string, onChunk connectors.ChunkFunc) (*connectors.ExecResult, error) {
+	if !l.IsAllowed(cmd, args) {
+		return nil, fmt.Errorf("command not allowed: %s %s", cmd, strings.Join(args, " "))
+	}
+
+	var key, fingerprint string
+	cacheable := l.cache != nil && isReadOnly(cmd, args)
+	if cacheable {
+		key = cacheKey(cmd, args, l.workDir)
+		fingerprint = l.stateFingerprint()
+		if result := l.cache.get(key, fingerprint); result != nil {
+			// Replay the stored output so chunk consumers (log persistence,
+			// live tails) see the same stream a real run would produce
+			if onChunk != nil {
+				if result.Stdout != "" {
+					onChunk("stdout", []byte(result.Stdout))
+				}
+				if result.Stderr != "" {
+					onChunk("stderr", []byte(result.Stderr))
+				}
+			}
+			return result, nil
+		}
+	}
+
+	release, err := l.acquire(ctx, cmd)
+	if err != nil {
+		return nil, err
+	}
+	defer release()
+
+	execCmd := exec.CommandContext(ctx, cmd, args...)
+	if l.workDir != "" {
+		execCmd.Dir = l.workDir
+	}
+
+	stdoutPipe, err := execCmd.StdoutPipe()
+	if err != nil {
+		return nil, fmt.Errorf("stdout pipe: %w", err)
+	}
+	stderrPipe, err := execCmd.StderrPipe()
+	if err != nil {
+		return nil, fmt.Errorf("stderr pipe: %w", err)
+	}
+
+	if err := execCmd.Start(); err != nil {
+		return nil, fmt.Errorf("exec error: %w", err)
+	}
+
+	var stdout, stderr bytes.Buffer
+	var wg sync.WaitGroup
+	wg.Add(2)
+	go drainStream("stdout", stdoutPipe, &stdout, onChunk, &wg)
+	go drainStream("stderr", stderrPipe, &stderr, onChunk, &wg)
+	wg.Wait()
+
+	exitCode := 0
+	if err := execCmd.Wait(); err != nil {
+		if exitError, ok := err.(*exec.ExitError); ok {
+			exitCode = exitError.ExitCode()
+		} else {
+			return nil, fmt.Errorf("exec error: %w", err)
+		}
+	}
+
+	result := &connectors.ExecResult{
+		Command:  cmd,
+		Args:     args,
+		ExitCode: exitCode,
+		Stdout:   stdout.String(),
+		Stderr:   stderr.String(),
+	}
+
+	if cacheable {
+		l.cache.put(key, fingerprint, result)
+	} else if l.cache != nil {
+		l.cache.invalidate()
+	}
+	return result, nil
+}
+
+// drainStream reads a pipe in fixed-size chunks, accumulating the full output
+// and forwarding each chunk to onChunk when set.
+func drainStream(name string, r io.Reader, buf *bytes.Buffer, onChunk connectors.ChunkFunc, wg *sync.WaitGroup) {
+	defer wg.Done()
+
+	chunk := make([]byte, 4096)
+	for {
+		n, err := r.Read(chunk)
+		if n > 0 {
+			buf.Write(chunk[:n])
+			if onChunk != nil {
+				onChunk(name, chunk[:n])
+			}
+		}
+		if err != nil {
+			return
+		}
+	}
 }
@@ -3,6 +3,8 @@ package localexec
 import (
 	"context"
 	"testing"
+
+	"github.com/fentz26/neona/internal/connectors"
 )
 
 func TestIsAllowed(t *testing.T) {
@@ -59,6 +61,165 @@ func TestExecute_NotAllowed(t *testing.T) {
 	}
 }
 
+func TestExecuteStream_ChunksMatchResult(t *testing.T) {
+	exec := New("")
+
+	var streamed []byte
+	ctx := context.Background()
+	result, err := exec.ExecuteStream(ctx, "git", []string{"status"}, func(stream string, data []byte) {
+		if stream == "stdout" {
+			streamed = append(streamed, data...)
+		}
+	})
+	if err != nil {
+		// Allowlist must still be enforced; environment failures are fine
+		t.Logf("ExecuteStream failed (expected in non-git dir): %v", err)
+		return
+	}
+
+	if string(streamed) != result.Stdout {
+		t.Errorf("Streamed chunks do not reassemble to result stdout: %d vs %d bytes", len(streamed), len(result.Stdout))
+	}
+}
+
+func TestExecuteStream_NotAllowed(t *testing.T) {
+	exec := New("")
+
+	_, err := exec.ExecuteStream(context.Background(), "rm", []string{"-rf", "/"}, nil)
+	if err == nil {
+		t.Error("Expected error for non-allowed command")
+	}
+}
+
+func TestCommandSlots(t *testing.T) {
+	exec := New("")
+
+	total := 0
+	for _, limit := range commandLimits {
+		total += limit
+	}
+	if exec.FreeSlots() != total {
+		t.Fatalf("FreeSlots() = %d, want %d", exec.FreeSlots(), total)
+	}
+
+	// Saturate the "go" class
+	ctx := context.Background()
+	releases := make([]func(), 0, commandLimits["go"])
+	for i := 0; i < commandLimits["go"]; i++ {
+		release, err := exec.acquire(ctx, "go")
+		if err != nil {
+			t.Fatalf("acquire failed: %v", err)
+		}
+		releases = append(releases, release)
+	}
+
+	if got := exec.FreeSlots(); got != total-commandLimits["go"] {
+		t.Errorf("FreeSlots() = %d after saturating go, want %d", got, total-commandLimits["go"])
+	}
+
+	// A queued acquire must honor context cancellation
+	cancelled, cancel := context.WithCancel(context.Background())
+	cancel()
+	if _, err := exec.acquire(cancelled, "go"); err == nil {
+		t.Error("Expected error acquiring saturated class with cancelled context")
+	}
+
+	// Unconfigured commands run unthrottled
+	release, err := exec.acquire(cancelled, "unknown")
+	if err != nil {
+		t.Fatalf("acquire for unthrottled command failed: %v", err)
+	}
+	release()
+
+	// Releasing restores capacity
+	for _, release := range releases {
+		release()
+	}
+	if exec.FreeSlots() != total {
+		t.Errorf("FreeSlots() = %d after release, want %d", exec.FreeSlots(), total)
+	}
+}
+
+func TestResultCache(t *testing.T) {
+	c := newResultCache()
+	key := cacheKey("git", []string{"status"}, "/tmp")
+	result := &connectors.ExecResult{Command: "git", Args: []string{"status"}, Stdout: "clean"}
+
+	if got := c.get(key, "fp1"); got != nil {
+		t.Error("Expected miss on empty cache")
+	}
+
+	c.put(key, "fp1", result)
+	got := c.get(key, "fp1")
+	if got == nil || got.Stdout != "clean" {
+		t.Fatalf("Expected cache hit with stored result, got %v", got)
+	}
+
+	// The hit is a copy; mutating it must not corrupt the cache
+	got.Stdout = "mutated"
+	if again := c.get(key, "fp1"); again == nil || again.Stdout != "clean" {
+		t.Error("Cached result was corrupted by mutating a returned copy")
+	}
+
+	// A changed state fingerprint misses and evicts
+	if got := c.get(key, "fp2"); got != nil {
+		t.Error("Expected miss after fingerprint change")
+	}
+	if got := c.get(key, "fp1"); got != nil {
+		t.Error("Expected stale entry to be evicted")
+	}
+
+	// Invalidation drops everything
+	c.put(key, "fp1", result)
+	c.invalidate()
+	if got := c.get(key, "fp1"); got != nil {
+		t.Error("Expected miss after invalidation")
+	}
+}
+
+func TestIsReadOnly(t *testing.T) {
+	tests := []struct {
+		cmd      string
+		args     []string
+		readOnly bool
+	}{
+		{"git", []string{"status"}, true},
+		{"git", []string{"diff"}, true},
+		{"git", []string{"push"}, false},
+		{"go", []string{"test"}, false}, // output depends on inputs the fingerprint can't see
+		{"git", []string{}, false},
+	}
+	for _, tt := range tests {
+		if got := isReadOnly(tt.cmd, tt.args); got != tt.readOnly {
+			t.Errorf("isReadOnly(%s, %v) = %v, want %v", tt.cmd, tt.args, got, tt.readOnly)
+		}
+	}
+}
+
+func TestExecute_ServedFromCache(t *testing.T) {
+	exec := New("")
+	exec.EnableResultCache()
+
+	ctx := context.Background()
+	if _, err := exec.Execute(ctx, "git", []string{"status"}); err != nil {
+		t.Logf("Execute failed (expected in non-git dir): %v", err)
+		return
+	}
+
+	// Poison the cached entry; a second call returning the sentinel proves
+	// it was served from the cache without spawning a process
+	key := cacheKey("git", []string{"status"}, "")
+	exec.cache.put(key, exec.stateFingerprint(), &connectors.ExecResult{Command: "git", Stdout: "cached-sentinel"})
+
+	again, err := exec.Execute(ctx, "git", []string{"status"})
+	if err != nil {
+		t.Fatalf("Execute failed: %v", err)
+	}
+	if again.Stdout != "cached-sentinel" {
+		t.Error("Expected second identical invocation to be served from cache")
+	}
+}
+
 func TestName(t *testing.T) {
 	exec := New("")
 	if exec.Name() != "localexec" {
@@ -0,0 +1,62 @@
+package controlplane
+
+import (
+	"sync"
+	"time"
+)
+
+// Event is one state-change notification published on the /events stream.
+type Event struct {
+	Type string      `json:"type"`
+	Data interface{} `json:"data,omitempty"`
+	Time time.Time   `json:"time"`
+}
+
+// subscriberBuffer is the per-subscriber event buffer. A subscriber that
+// falls further behind than this misses events rather than stalling
+// publishers; clients recover by re-fetching the affected lists.
+const subscriberBuffer = 16
+
+// EventHub fans state-change events out to /events subscribers. Publish
+// never blocks, so it is safe to call from request handlers and scheduler
+// loops.
+type EventHub struct {
+	mu   sync.Mutex
+	subs map[chan Event]struct{}
+}
+
+// NewEventHub creates an empty event hub.
+func NewEventHub() *EventHub {
+	return &EventHub{subs: make(map[chan Event]struct{})}
+}
+
+// Publish sends an event to every current subscriber without blocking.
+func (h *EventHub) Publish(eventType string, data interface{}) {
+	ev := Event{Type: eventType, Data: data, Time: time.Now().UTC()}
+
+	h.mu.Lock()
+	defer h.mu.Unlock()
+	for ch := range h.subs {
+		select {
+		case ch <- ev:
+		default:
+			// Subscriber buffer full; drop rather than block the publisher
+		}
+	}
+}
+
+// subscribe registers a new subscriber channel.
+func (h *EventHub) subscribe() chan Event {
+	ch := make(chan Event, subscriberBuffer)
+	h.mu.Lock()
+	h.subs[ch] = struct{}{}
+	h.mu.Unlock()
+	return ch
+}
+
+// unsubscribe removes a subscriber channel.
+func (h *EventHub) unsubscribe(ch chan Event) {
+	h.mu.Lock()
+	delete(h.subs, ch)
+	h.mu.Unlock()
+}
@@ -0,0 +1,51 @@
+package controlplane
+
+import (
+	"testing"
+	"time"
+)
+
+func TestEventHubPublishSubscribe(t *testing.T) {
+	hub := NewEventHub()
+
+	sub := hub.subscribe()
+	defer hub.unsubscribe(sub)
+
+	hub.Publish("task.created", map[string]string{"task_id": "abc"})
+
+	select {
+	case ev := <-sub:
+		if ev.Type != "task.created" {
+			t.Errorf("Expected event type task.created, got %s", ev.Type)
+		}
+	case <-time.After(time.Second):
+		t.Fatal("Timeout waiting for published event")
+	}
+}
+
+func TestEventHubSlowSubscriberDoesNotBlock(t *testing.T) {
+	hub := NewEventHub()
+
+	sub := hub.subscribe()
+	defer hub.unsubscribe(sub)
+
+	// Overfill the subscriber buffer; Publish must never block
+	done := make(chan struct{})
+	go func() {
+		for i := 0; i < subscriberBuffer*2; i++ {
+			hub.Publish("task.created", nil)
+		}
+		close(done)
+	}()
+
+	select {
+	case <-done:
+	case <-time.After(time.Second):
+		t.Fatal("Publish blocked on a slow subscriber")
+	}
+
+	// The buffer holds the first events; later ones were dropped
+	if got := len(sub); got != subscriberBuffer {
+		t.Errorf("Expected %d buffered events, got %d", subscriberBuffer, got)
+	}
+}
@@ -3,16 +3,45 @@ package controlplane
 import (
 	"context"
 	"encoding/json"
+	"fmt"
 	"log"
+	"net"
 	"net/http"
+	"os"
+	"strconv"
 	"strings"
 	"time"
 
 	"github.com/fentz26/neona/internal/mcp"
+	"github.com/fentz26/neona/internal/metrics"
 	"github.com/fentz26/neona/internal/models"
 	"github.com/fentz26/neona/internal/store"
 )
 
+// requestDuration tracks handler latency per top-level route.
+var requestDuration = metrics.NewHistogramVec("neona_http_request_seconds",
+	"HTTP handler latency by route.", "route", metrics.DefBuckets)
+
+// instrumentHandler wraps the mux to time every request. Routes are
+// bucketed by first path segment so task IDs don't explode cardinality;
+// streaming endpoints are skipped since they stay open indefinitely.
+func instrumentHandler(next http.Handler) http.Handler {
+	return http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		route := r.URL.Path
+		if idx := strings.Index(route[1:], "/"); idx >= 0 {
+			route = route[:idx+1]
+		}
+		if route == "/events" || r.URL.Query().Get("follow") == "1" {
+			next.ServeHTTP(w, r)
+			return
+		}
+
+		start := time.Now()
+		next.ServeHTTP(w, r)
+		requestDuration.With(r.Method + " " + route).Observe(time.Since(start).Seconds())
+	})
+}
+
 // Version is set at build time or defaults to "dev".
 var Version = "dev"
 
@@ -34,6 +63,9 @@ type Server struct {
 	server    *http.Server
 	scheduler SchedulerStatsProvider
 	mcpRouter MCPRouter
+	events    *EventHub
+	// socketPath, when set, adds a unix domain socket listener alongside TCP
+	socketPath string
 }
 
 // NewServer creates a new HTTP server.
@@ -57,40 +89,87 @@ func (s *Server) SetMCPRouter(router MCPRouter) {
 	s.mcpRouter = router
 }
 
+// SetEventHub sets the hub backing the /events stream.
+// Must be called before Start() - not safe for concurrent use.
+func (s *Server) SetEventHub(hub *EventHub) {
+	s.events = hub
+}
+
+// SetSocketPath enables an additional unix domain socket listener serving the
+// same API; local clients prefer it over TCP.
+// Must be called before Start() - not safe for concurrent use.
+func (s *Server) SetSocketPath(path string) {
+	s.socketPath = path
+}
+
 // Start starts the HTTP server.
 func (s *Server) Start() error {
 	mux := http.NewServeMux()
 
 	// Task endpoints
 	mux.HandleFunc("/tasks", s.handleTasks)
+	mux.HandleFunc("/tasks/bulk", s.handleTasksBulk)
 	mux.HandleFunc("/tasks/", s.handleTaskByID)
 
+	// Run log endpoint
+	mux.HandleFunc("/runs/", s.handleRunByID)
+
 	// Memory endpoints
 	mux.HandleFunc("/memory", s.handleMemory)
 
 	// Worker pool monitor endpoint
 	mux.HandleFunc("/workers", s.handleWorkers)
 
+	// PDR audit query endpoint
+	mux.HandleFunc("/pdr", s.handlePDR)
+
 	// MCP routing endpoint
 	mux.HandleFunc("/mcp/route", s.handleMCPRoute)
 
+	// Server-sent events stream
+	mux.HandleFunc("/events", s.handleEvents)
+
 	// Health check with DB ping
 	mux.HandleFunc("/health", s.handleHealth)
 
+	// Prometheus-style metrics
+	mux.Handle("/metrics", metrics.Handler())
+
 	s.server = &http.Server{
 		Addr:         s.addr,
-		Handler:      mux,
+		Handler:      instrumentHandler(mux),
 		ReadTimeout:  10 * time.Second,
 		WriteTimeout: 30 * time.Second,
 	}
 
+	// Serve the same API on the unix socket when configured; requests from
+	// local clients then skip the TCP stack entirely.
+	if s.socketPath != "" {
+		os.Remove(s.socketPath) // stale socket from an unclean shutdown
+		ln, err := net.Listen("unix", s.socketPath)
+		if err != nil {
+			log.Printf("Warning: unix socket unavailable: %v", err)
+		} else {
+			log.Printf("Also listening on unix socket %s", s.socketPath)
+			go func() {
+				if err := s.server.Serve(ln); err != nil && err != http.ErrServerClosed {
+					log.Printf("Unix socket serve error: %v", err)
+				}
+			}()
+		}
+	}
+
 	log.Printf("Starting Neona daemon on %s", s.addr)
 	return s.server.ListenAndServe()
 }
 
-// Shutdown gracefully shuts down the server.
+// Shutdown gracefully shuts down the server and removes the unix socket.
 func (s *Server) Shutdown(ctx context.Context) error {
-	return s.server.Shutdown(ctx)
+	err := s.server.Shutdown(ctx)
+	if s.socketPath != "" {
+		os.Remove(s.socketPath)
+	}
+	return err
 }
 
 // HealthResponse represents the /health endpoint response.
@@ -175,11 +254,48 @@ func (s *Server) handleTaskByID(w http.ResponseWriter, r *http.Request) {
 		s.getTaskLogs(w, r, taskID)
 	case action == "memory" && r.Method == http.MethodGet:
 		s.getTaskMemory(w, r, taskID)
+	case action == "archive" && r.Method == http.MethodGet:
+		s.getArchivedTask(w, r, taskID)
 	default:
 		http.Error(w, "not found", http.StatusNotFound)
 	}
 }
 
+// handleRunByID handles /runs/{id}/log
+func (s *Server) handleRunByID(w http.ResponseWriter, r *http.Request) {
+	path := strings.TrimPrefix(r.URL.Path, "/runs/")
+	parts := strings.Split(path, "/")
+
+	if len(parts) == 0 || parts[0] == "" {
+		http.Error(w, "run id required", http.StatusBadRequest)
+		return
+	}
+
+	runID := parts[0]
+	action := ""
+	if len(parts) > 1 {
+		action = parts[1]
+	}
+
+	if action != "log" || r.Method != http.MethodGet {
+		http.Error(w, "not found", http.StatusNotFound)
+		return
+	}
+
+	stdout, stderr, err := s.service.GetRunOutput(runID)
+	if err != nil {
+		http.Error(w, err.Error(), http.StatusInternalServerError)
+		return
+	}
+
+	w.Header().Set("Content-Type", "application/json")
+	json.NewEncoder(w).Encode(map[string]string{
+		"run_id": runID,
+		"stdout": stdout,
+		"stderr": stderr,
+	})
+}
+
 // handleMemory handles POST /memory and GET /memory
 func (s *Server) handleMemory(w http.ResponseWriter, r *http.Request) {
 	switch r.Method {
@@ -195,8 +311,10 @@ func (s *Server) handleMemory(w http.ResponseWriter, r *http.Request) {
 // --- Task Handlers ---
 
 type createTaskRequest struct {
-	Title       string `json:"title"`
-	Description string `json:"description"`
+	Title       string     `json:"title"`
+	Description string     `json:"description"`
+	Priority    int        `json:"priority"`
+	Deadline    *time.Time `json:"deadline,omitempty"`
 }
 
 func (s *Server) createTask(w http.ResponseWriter, r *http.Request) {
@@ -206,7 +324,7 @@ func (s *Server) createTask(w http.ResponseWriter, r *http.Request) {
 		return
 	}
 
-	task, err := s.service.CreateTask(req.Title, req.Description)
+	task, err := s.service.CreateTask(req.Title, req.Description, req.Priority, req.Deadline)
 	if err != nil {
 		http.Error(w, err.Error(), http.StatusInternalServerError)
 		return
@@ -217,9 +335,98 @@ func (s *Server) createTask(w http.ResponseWriter, r *http.Request) {
 	json.NewEncoder(w).Encode(task)
 }
 
+type createTasksBulkRequest struct {
+	Tasks []createTaskRequest `json:"tasks"`
+}
+
+// handleTasksBulk handles POST /tasks/bulk. The whole batch is inserted in
+// one store transaction, so a burst enqueue costs one commit instead of one
+// per task.
+func (s *Server) handleTasksBulk(w http.ResponseWriter, r *http.Request) {
+	if r.Method != http.MethodPost {
+		http.Error(w, "method not allowed", http.StatusMethodNotAllowed)
+		return
+	}
+
+	var req createTasksBulkRequest
+	if err := json.NewDecoder(r.Body).Decode(&req); err != nil {
+		http.Error(w, "invalid json", http.StatusBadRequest)
+		return
+	}
+	if len(req.Tasks) == 0 {
+		http.Error(w, "tasks required", http.StatusBadRequest)
+		return
+	}
+
+	specs := make([]store.TaskSpec, len(req.Tasks))
+	for i, t := range req.Tasks {
+		specs[i] = store.TaskSpec{
+			Title:       t.Title,
+			Description: t.Description,
+			Priority:    t.Priority,
+			Deadline:    t.Deadline,
+		}
+	}
+
+	tasks, err := s.service.CreateTasks(specs)
+	if err != nil {
+		http.Error(w, err.Error(), http.StatusInternalServerError)
+		return
+	}
+
+	w.Header().Set("Content-Type", "application/json")
+	w.WriteHeader(http.StatusCreated)
+	json.NewEncoder(w).Encode(tasks)
+}
+
 func (s *Server) listTasks(w http.ResponseWriter, r *http.Request) {
-	status := r.URL.Query().Get("status")
-	tasks, err := s.service.ListTasks(status)
+	q := r.URL.Query()
+	status := q.Get("status")
+	claimedBy := q.Get("claimed_by")
+	cursor := q.Get("cursor")
+
+	// Cheap validator over the tasks table: when nothing changed, the
+	// refresh is a header exchange instead of a full body.
+	if version, err := s.service.TasksVersion(); err == nil {
+		etag := `"` + version + `"`
+		if r.Header.Get("If-None-Match") == etag {
+			w.WriteHeader(http.StatusNotModified)
+			return
+		}
+		w.Header().Set("ETag", etag)
+	}
+
+	// Delta mode: only rows changed since the given updated_at
+	if sinceParam := q.Get("since"); sinceParam != "" {
+		since, err := time.Parse(time.RFC3339Nano, sinceParam)
+		if err != nil {
+			http.Error(w, "invalid since", http.StatusBadRequest)
+			return
+		}
+		tasks, err := s.service.ListTasksSince(since, status)
+		if err != nil {
+			http.Error(w, err.Error(), http.StatusInternalServerError)
+			return
+		}
+		if tasks == nil {
+			tasks = []models.Task{}
+		}
+		w.Header().Set("Content-Type", "application/json")
+		json.NewEncoder(w).Encode(tasks)
+		return
+	}
+
+	limit := 0
+	if v := q.Get("limit"); v != "" {
+		n, err := strconv.Atoi(v)
+		if err != nil || n < 0 {
+			http.Error(w, "invalid limit", http.StatusBadRequest)
+			return
+		}
+		limit = n
+	}
+
+	tasks, next, err := s.service.ListTasksPage(status, claimedBy, limit, cursor)
 	if err != nil {
 		http.Error(w, err.Error(), http.StatusInternalServerError)
 		return
@@ -230,6 +437,11 @@ func (s *Server) listTasks(w http.ResponseWriter, r *http.Request) {
 	}
 
 	w.Header().Set("Content-Type", "application/json")
+	// The body stays a bare array for existing clients; the cursor for the
+	// next page travels in a header.
+	if next != "" {
+		w.Header().Set("X-Next-Cursor", next)
+	}
 	json.NewEncoder(w).Encode(tasks)
 }
 
@@ -248,6 +460,23 @@ func (s *Server) getTask(w http.ResponseWriter, r *http.Request, taskID string)
 	json.NewEncoder(w).Encode(task)
 }
 
+// getArchivedTask handles GET /tasks/{id}/archive: the cold-storage lookup
+// for tasks the archiver has moved out of the hot database.
+func (s *Server) getArchivedTask(w http.ResponseWriter, r *http.Request, taskID string) {
+	record, err := s.service.GetArchivedTask(taskID)
+	if err != nil {
+		http.Error(w, err.Error(), http.StatusInternalServerError)
+		return
+	}
+	if record == nil {
+		http.Error(w, "task not found in archive", http.StatusNotFound)
+		return
+	}
+
+	w.Header().Set("Content-Type", "application/json")
+	json.NewEncoder(w).Encode(record)
+}
+
 type claimRequest struct {
 	HolderID string `json:"holder_id"`
 	TTLSec   int    `json:"ttl_sec"`
@@ -330,6 +559,11 @@ func (s *Server) runTask(w http.ResponseWriter, r *http.Request, taskID string)
 }
 
 func (s *Server) getTaskLogs(w http.ResponseWriter, r *http.Request, taskID string) {
+	if r.URL.Query().Get("follow") == "1" {
+		s.followTaskLogs(w, r, taskID)
+		return
+	}
+
 	runs, err := s.service.GetTaskLogs(taskID)
 	if err != nil {
 		http.Error(w, err.Error(), http.StatusInternalServerError)
@@ -344,6 +578,76 @@ func (s *Server) getTaskLogs(w http.ResponseWriter, r *http.Request, taskID stri
 	json.NewEncoder(w).Encode(runs)
 }
 
+// followTaskLogs streams the most recent run's output as plain text until the
+// run ends or the client disconnects. Output persisted chunk by chunk while
+// the command executes shows up here live.
+func (s *Server) followTaskLogs(w http.ResponseWriter, r *http.Request, taskID string) {
+	runs, err := s.service.GetTaskLogs(taskID)
+	if err != nil {
+		http.Error(w, err.Error(), http.StatusInternalServerError)
+		return
+	}
+	if len(runs) == 0 {
+		http.Error(w, "no runs for task", http.StatusNotFound)
+		return
+	}
+	runID := runs[0].ID // newest first
+
+	flusher, ok := w.(http.Flusher)
+	if !ok {
+		http.Error(w, "streaming unsupported", http.StatusInternalServerError)
+		return
+	}
+
+	// The tail outlives the server's write timeout; clear the deadline for
+	// this response only.
+	http.NewResponseController(w).SetWriteDeadline(time.Time{})
+
+	w.Header().Set("Content-Type", "text/plain; charset=utf-8")
+	w.Header().Set("Cache-Control", "no-cache")
+	w.WriteHeader(http.StatusOK)
+	flusher.Flush()
+
+	ticker := time.NewTicker(500 * time.Millisecond)
+	defer ticker.Stop()
+
+	seqs := map[string]int{"stdout": -1, "stderr": -1}
+	for {
+		wrote := false
+		for _, stream := range []string{"stdout", "stderr"} {
+			data, seq, err := s.service.GetRunLogSince(runID, stream, seqs[stream])
+			if err != nil {
+				return
+			}
+			if len(data) > 0 {
+				if _, err := w.Write(data); err != nil {
+					return
+				}
+				wrote = true
+			}
+			seqs[stream] = seq
+		}
+		if wrote {
+			flusher.Flush()
+		}
+
+		// Stop once the run has ended and the final chunks are drained
+		run, err := s.service.GetRun(runID)
+		if err != nil || run == nil {
+			return
+		}
+		if !run.EndedAt.IsZero() && !wrote {
+			return
+		}
+
+		select {
+		case <-r.Context().Done():
+			return
+		case <-ticker.C:
+		}
+	}
+}
+
 func (s *Server) getTaskMemory(w http.ResponseWriter, r *http.Request, taskID string) {
 	items, err := s.service.GetTaskMemory(taskID)
 	if err != nil {
@@ -387,7 +691,8 @@ func (s *Server) addMemory(w http.ResponseWriter, r *http.Request) {
 
 func (s *Server) queryMemory(w http.ResponseWriter, r *http.Request) {
 	query := r.URL.Query().Get("q")
-	items, err := s.service.QueryMemory(query)
+	tag := r.URL.Query().Get("tag")
+	items, err := s.service.QueryMemory(query, tag)
 	if err != nil {
 		http.Error(w, err.Error(), http.StatusInternalServerError)
 		return
@@ -401,6 +706,130 @@ func (s *Server) queryMemory(w http.ResponseWriter, r *http.Request) {
 	json.NewEncoder(w).Encode(items)
 }
 
+// --- PDR Handler ---
+
+// handlePDR handles GET /pdr: the audit trail query endpoint. Filters:
+// ?since= and ?until= (RFC3339) bound the time range, ?action= and
+// ?task_id= narrow the records, ?limit= caps the page. ?rollup=1 returns
+// the daily aggregates of compacted records instead of raw entries.
+func (s *Server) handlePDR(w http.ResponseWriter, r *http.Request) {
+	if r.Method != http.MethodGet {
+		http.Error(w, "method not allowed", http.StatusMethodNotAllowed)
+		return
+	}
+
+	q := r.URL.Query()
+
+	var since, until time.Time
+	if v := q.Get("since"); v != "" {
+		t, err := time.Parse(time.RFC3339Nano, v)
+		if err != nil {
+			http.Error(w, "invalid since timestamp", http.StatusBadRequest)
+			return
+		}
+		since = t
+	}
+	if v := q.Get("until"); v != "" {
+		t, err := time.Parse(time.RFC3339Nano, v)
+		if err != nil {
+			http.Error(w, "invalid until timestamp", http.StatusBadRequest)
+			return
+		}
+		until = t
+	}
+	action := q.Get("action")
+
+	if q.Get("rollup") == "1" {
+		rollups, err := s.service.QueryPDRRollups(since, until, action)
+		if err != nil {
+			http.Error(w, err.Error(), http.StatusInternalServerError)
+			return
+		}
+		if rollups == nil {
+			rollups = []models.PDRRollup{}
+		}
+		w.Header().Set("Content-Type", "application/json")
+		json.NewEncoder(w).Encode(rollups)
+		return
+	}
+
+	limit := 0
+	if v := q.Get("limit"); v != "" {
+		n, err := strconv.Atoi(v)
+		if err != nil || n < 0 {
+			http.Error(w, "invalid limit", http.StatusBadRequest)
+			return
+		}
+		limit = n
+	}
+
+	entries, err := s.service.QueryPDR(since, until, action, q.Get("task_id"), limit)
+	if err != nil {
+		http.Error(w, err.Error(), http.StatusInternalServerError)
+		return
+	}
+	if entries == nil {
+		entries = []models.PDREntry{}
+	}
+	w.Header().Set("Content-Type", "application/json")
+	json.NewEncoder(w).Encode(entries)
+}
+
+// --- Event Stream Handler ---
+
+// handleEvents handles GET /events: a server-sent events stream of task
+// transitions, worker start/stop, and lease changes. Clients subscribe once
+// and refresh on notification instead of polling the list endpoints.
+func (s *Server) handleEvents(w http.ResponseWriter, r *http.Request) {
+	if r.Method != http.MethodGet {
+		http.Error(w, "method not allowed", http.StatusMethodNotAllowed)
+		return
+	}
+	if s.events == nil {
+		http.Error(w, "events not configured", http.StatusServiceUnavailable)
+		return
+	}
+	flusher, ok := w.(http.Flusher)
+	if !ok {
+		http.Error(w, "streaming unsupported", http.StatusInternalServerError)
+		return
+	}
+
+	// The stream outlives the server's write timeout; clear the deadline for
+	// this response only.
+	http.NewResponseController(w).SetWriteDeadline(time.Time{})
+
+	w.Header().Set("Content-Type", "text/event-stream")
+	w.Header().Set("Cache-Control", "no-cache")
+	w.Header().Set("Connection", "keep-alive")
+	w.WriteHeader(http.StatusOK)
+	flusher.Flush()
+
+	sub := s.events.subscribe()
+	defer s.events.unsubscribe(sub)
+
+	// Periodic comments keep idle connections alive through proxies
+	keepalive := time.NewTicker(30 * time.Second)
+	defer keepalive.Stop()
+
+	for {
+		select {
+		case <-r.Context().Done():
+			return
+		case ev := <-sub:
+			data, err := json.Marshal(ev)
+			if err != nil {
+				continue
+			}
+			fmt.Fprintf(w, "event: %s\ndata: %s\n\n", ev.Type, data)
+			flusher.Flush()
+		case <-keepalive.C:
+			fmt.Fprint(w, ": keepalive\n\n")
+			flusher.Flush()
+		}
+	}
+}
+
 // --- Worker Pool Handlers ---
 
 // handleWorkers handles GET /workers
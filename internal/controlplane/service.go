@@ -4,6 +4,8 @@ package controlplane
 import (
 	"context"
 	"fmt"
+	"log"
+	"time"
 
 	"github.com/fentz26/neona/internal/audit"
 	"github.com/fentz26/neona/internal/connectors"
@@ -11,11 +13,19 @@ import (
 	"github.com/fentz26/neona/internal/store"
 )
 
+// DispatchNotifier is signalled when new work is enqueued so the scheduler
+// can dispatch immediately instead of waiting for its next poll.
+type DispatchNotifier interface {
+	Notify()
+}
+
 // Service provides the control plane business logic.
 type Service struct {
 	store     *store.Store
 	pdr       *audit.PDRWriter
 	connector connectors.Connector
+	notifier  DispatchNotifier
+	events    *EventHub
 }
 
 // NewService creates a new control plane service.
@@ -27,29 +37,96 @@ func NewService(s *store.Store, pdr *audit.PDRWriter, conn connectors.Connector)
 	}
 }
 
+// SetDispatchNotifier sets the notifier signalled on task creation.
+// Must be called before the server starts - not safe for concurrent use.
+func (s *Service) SetDispatchNotifier(n DispatchNotifier) {
+	s.notifier = n
+}
+
+// SetEventHub sets the hub that receives task and lease events.
+// Must be called before the server starts - not safe for concurrent use.
+func (s *Service) SetEventHub(hub *EventHub) {
+	s.events = hub
+}
+
+// publish emits an event if a hub is configured.
+func (s *Service) publish(eventType string, data interface{}) {
+	if s.events != nil {
+		s.events.Publish(eventType, data)
+	}
+}
+
 // --- Task Operations ---
 
-// CreateTask creates a new task.
-func (s *Service) CreateTask(title, description string) (*models.Task, error) {
-	task, err := s.store.CreateTask(title, description)
+// CreateTask creates a new task. priority defaults to 0; deadline is optional
+// (nil for none) and escalates the task's priority as it approaches.
+func (s *Service) CreateTask(title, description string, priority int, deadline *time.Time) (*models.Task, error) {
+	task, err := s.store.CreateTaskWithPriority(title, description, priority, deadline)
 	if err != nil {
 		return nil, err
 	}
 
 	s.pdr.Record("task.create", map[string]string{"title": title}, "success", task.ID, "")
+	s.publish("task.created", map[string]string{"task_id": task.ID, "status": string(task.Status)})
+	if s.notifier != nil {
+		s.notifier.Notify()
+	}
 	return task, nil
 }
 
+// CreateTasks creates a batch of tasks in one store transaction. Planner
+// agents enqueue hundreds of subtasks at once; the batch costs one commit,
+// one PDR record, and one scheduler wake instead of one of each per task.
+func (s *Service) CreateTasks(specs []store.TaskSpec) ([]models.Task, error) {
+	tasks, err := s.store.CreateTasks(specs)
+	if err != nil {
+		return nil, err
+	}
+
+	ids := make([]string, len(tasks))
+	for i, task := range tasks {
+		ids[i] = task.ID
+	}
+	s.pdr.Record("task.create_bulk", map[string]interface{}{"count": len(tasks), "task_ids": ids}, "success", "", "")
+	s.publish("tasks.created", map[string]interface{}{"count": len(tasks), "task_ids": ids})
+	if s.notifier != nil {
+		s.notifier.Notify()
+	}
+	return tasks, nil
+}
+
 // GetTask retrieves a task by ID.
 func (s *Service) GetTask(id string) (*models.Task, error) {
 	return s.store.GetTask(id)
 }
 
+// GetArchivedTask retrieves a task from cold storage, with its runs and
+// lease history. Returns nil when the task was never archived.
+func (s *Service) GetArchivedTask(id string) (*store.ArchivedTask, error) {
+	return s.store.GetArchivedTask(id)
+}
+
 // ListTasks returns filtered tasks.
 func (s *Service) ListTasks(status string) ([]models.Task, error) {
 	return s.store.ListTasks(status)
 }
 
+// ListTasksPage returns one page of filtered tasks plus the cursor for the
+// next page ("" when exhausted).
+func (s *Service) ListTasksPage(status, claimedBy string, limit int, cursor string) ([]models.Task, string, error) {
+	return s.store.ListTasksPage(status, claimedBy, limit, cursor)
+}
+
+// TasksVersion returns the cheap tasks-table validator served as an ETag.
+func (s *Service) TasksVersion() (string, error) {
+	return s.store.TasksVersion()
+}
+
+// ListTasksSince returns tasks changed after since, oldest change first.
+func (s *Service) ListTasksSince(since time.Time, status string) ([]models.Task, error) {
+	return s.store.ListTasksSince(since, status)
+}
+
 // ClaimTask claims a task with a lease atomically.
 func (s *Service) ClaimTask(taskID, holderID string, ttlSec int) (*models.Lease, error) {
 	result, err := s.store.ClaimTaskWithLeaseTx(taskID, holderID, ttlSec)
@@ -65,6 +142,7 @@ func (s *Service) ClaimTask(taskID, holderID string, ttlSec int) (*models.Lease,
 	}
 
 	s.pdr.Record("task.claim", map[string]interface{}{"task_id": taskID, "holder_id": holderID, "ttl": ttlSec}, "success", taskID, "")
+	s.publish("task.claimed", map[string]string{"task_id": taskID, "holder_id": holderID})
 	return result.Lease, nil
 }
 
@@ -89,6 +167,7 @@ func (s *Service) ReleaseTask(taskID, holderID string) error {
 	}
 
 	s.pdr.Record("task.release", map[string]string{"task_id": taskID, "holder_id": holderID}, "success", taskID, "")
+	s.publish("task.released", map[string]string{"task_id": taskID})
 	return nil
 }
 
@@ -114,8 +193,22 @@ func (s *Service) RunTask(taskID, holderID, command string, args []string) (*mod
 		return nil, err
 	}
 
-	// Execute via connector
-	result, execErr := s.connector.Execute(context.Background(), command, args)
+	// Execute via connector. Streaming connectors persist output chunk by
+	// chunk while the command runs, so live tails (logs?follow=1) see it
+	// before the command exits; others buffer and persist at the end.
+	var result *connectors.ExecResult
+	var execErr error
+	streamed := false
+	if sc, ok := s.connector.(connectors.StreamingConnector); ok {
+		streamed = true
+		result, execErr = sc.ExecuteStream(context.Background(), command, args, func(stream string, data []byte) {
+			if err := s.store.AppendRunLog(run.ID, stream, data); err != nil {
+				log.Printf("Error persisting run output chunk: %v", err)
+			}
+		})
+	} else {
+		result, execErr = s.connector.Execute(context.Background(), command, args)
+	}
 
 	outcome := "success"
 	var exitCode int
@@ -134,8 +227,12 @@ func (s *Service) RunTask(taskID, holderID, command string, args []string) (*mod
 		}
 	}
 
-	// Update run record
-	if err := s.store.UpdateRun(run.ID, exitCode, stdout, stderr); err != nil {
+	// Update run record; streamed output is already persisted
+	if streamed && execErr == nil {
+		if err := s.store.FinishRun(run.ID, exitCode); err != nil {
+			return nil, err
+		}
+	} else if err := s.store.UpdateRun(run.ID, exitCode, stdout, stderr); err != nil {
 		return nil, err
 	}
 
@@ -145,6 +242,7 @@ func (s *Service) RunTask(taskID, holderID, command string, args []string) (*mod
 		status = models.TaskStatusFailed
 	}
 	s.store.UpdateTaskStatus(taskID, status)
+	s.publish("task."+string(status), map[string]string{"task_id": taskID, "run_id": run.ID})
 
 	// Record PDR
 	s.pdr.Record("task.run", map[string]interface{}{"task_id": taskID, "command": command, "args": args}, outcome, taskID, "")
@@ -158,11 +256,28 @@ func (s *Service) RunTask(taskID, holderID, command string, args []string) (*mod
 	return run, nil
 }
 
-// GetTaskLogs returns run logs for a task.
+// GetTaskLogs returns run metadata for a task; output is fetched lazily via
+// GetRunOutput.
 func (s *Service) GetTaskLogs(taskID string) ([]models.Run, error) {
 	return s.store.GetRunsForTask(taskID)
 }
 
+// GetRunOutput returns the stored output streams for a run.
+func (s *Service) GetRunOutput(runID string) (stdout, stderr string, err error) {
+	return s.store.GetRunOutput(runID)
+}
+
+// GetRun returns a run's metadata (no output), or nil when not found.
+func (s *Service) GetRun(runID string) (*models.Run, error) {
+	return s.store.GetRun(runID)
+}
+
+// GetRunLogSince returns one stream's output past afterSeq along with the new
+// high-water seq; used by live log tails.
+func (s *Service) GetRunLogSince(runID, stream string, afterSeq int) ([]byte, int, error) {
+	return s.store.GetRunLogSince(runID, stream, afterSeq)
+}
+
 // RenewLease renews a lease (heartbeat).
 func (s *Service) RenewLease(taskID, holderID string, ttlSec int) error {
 	lease, err := s.store.GetActiveLease(taskID)
@@ -172,7 +287,11 @@ func (s *Service) RenewLease(taskID, holderID string, ttlSec int) error {
 	if lease == nil || lease.HolderID != holderID {
 		return ErrNotOwner
 	}
-	return s.store.RenewLease(lease.ID, ttlSec)
+	if err := s.store.RenewLease(lease.ID, ttlSec); err != nil {
+		return err
+	}
+	s.publish("lease.renewed", map[string]string{"task_id": taskID, "holder_id": holderID})
+	return nil
 }
 
 // --- Memory Operations ---
@@ -187,9 +306,9 @@ func (s *Service) AddMemory(taskID, content, tags string) (*models.MemoryItem, e
 	return item, nil
 }
 
-// QueryMemory searches memory items.
-func (s *Service) QueryMemory(query string) ([]models.MemoryItem, error) {
-	return s.store.QueryMemory(query)
+// QueryMemory searches memory items, optionally scoped to a tag.
+func (s *Service) QueryMemory(query, tag string) ([]models.MemoryItem, error) {
+	return s.store.QueryMemory(query, tag)
 }
 
 // GetTaskMemory returns memory items for a task.
@@ -197,6 +316,19 @@ func (s *Service) GetTaskMemory(taskID string) ([]models.MemoryItem, error) {
 	return s.store.GetMemoryForTask(taskID)
 }
 
+// --- PDR Operations ---
+
+// QueryPDR returns raw audit records filtered by time range, action, and
+// task ID, newest first.
+func (s *Service) QueryPDR(since, until time.Time, action, taskID string, limit int) ([]models.PDREntry, error) {
+	return s.store.QueryPDR(since, until, action, taskID, limit)
+}
+
+// QueryPDRRollups returns the daily aggregates of compacted audit records.
+func (s *Service) QueryPDRRollups(since, until time.Time, action string) ([]models.PDRRollup, error) {
+	return s.store.QueryPDRRollups(since, until, action)
+}
+
 // --- Lock Operations ---
 
 // AcquireLock acquires a lock on a resource.
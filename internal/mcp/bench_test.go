@@ -0,0 +1,36 @@
+package mcp
+
+import (
+	"context"
+	"fmt"
+	"testing"
+)
+
+func BenchmarkRoute(b *testing.B) {
+	cfg := DefaultConfig()
+	reg := NewRegistry()
+	reg.RegisterDefaults()
+	router := NewRouter(cfg, reg)
+
+	// Repeated text hits the routing result cache
+	b.Run("cached", func(b *testing.B) {
+		task := Task{ID: "bench", Title: "Create a GitHub PR for the feature branch"}
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			if _, err := router.Route(context.Background(), task); err != nil {
+				b.Fatalf("Route failed: %v", err)
+			}
+		}
+	})
+
+	// Unique text per iteration exercises the full matcher and budget path
+	b.Run("unique", func(b *testing.B) {
+		b.ResetTimer()
+		for i := 0; i < b.N; i++ {
+			task := Task{ID: "bench", Title: fmt.Sprintf("Deploy build %d to vercel production", i)}
+			if _, err := router.Route(context.Background(), task); err != nil {
+				b.Fatalf("Route failed: %v", err)
+			}
+		}
+	})
+}
@@ -0,0 +1,93 @@
+package mcp
+
+import (
+	"regexp"
+	"strings"
+)
+
+// ruleMatcher holds the routing rules compiled into a form that can be
+// matched in one pass over the task text. Regex patterns are compiled once
+// and single-word keywords are inverted into a word -> rule index map, so
+// matching cost no longer scales with rules x keywords x words.
+type ruleMatcher struct {
+	numRules int
+	// patterns is index-aligned with the rules; nil where a rule has no
+	// pattern or the pattern failed to compile.
+	patterns []*regexp.Regexp
+	// words maps a lowercased single-word keyword to the rules it triggers.
+	words map[string][]int
+	// phrases holds multi-word keywords, matched by substring search.
+	phrases []phraseEntry
+}
+
+type phraseEntry struct {
+	phrase string
+	rule   int
+}
+
+// newRuleMatcher compiles the given rules. Invalid regex patterns are
+// skipped, matching the previous behavior of ignoring MatchString errors.
+func newRuleMatcher(rules []RoutingRule) *ruleMatcher {
+	m := &ruleMatcher{
+		numRules: len(rules),
+		patterns: make([]*regexp.Regexp, len(rules)),
+		words:    make(map[string][]int),
+	}
+
+	for i, rule := range rules {
+		if rule.Pattern != "" {
+			if re, err := regexp.Compile(rule.Pattern); err == nil {
+				m.patterns[i] = re
+			}
+		}
+		for _, keyword := range rule.Keywords {
+			keyword = strings.ToLower(keyword)
+			if strings.Contains(keyword, " ") {
+				m.phrases = append(m.phrases, phraseEntry{phrase: keyword, rule: i})
+			} else {
+				m.words[keyword] = append(m.words[keyword], i)
+			}
+		}
+	}
+
+	return m
+}
+
+// match returns the indices of all rules triggered by text, in rule order.
+// text must already be lowercased.
+func (m *ruleMatcher) match(text string) []int {
+	if m.numRules == 0 {
+		return nil
+	}
+
+	hit := make([]bool, m.numRules)
+
+	// Tokenize once and look each word up, instead of re-splitting the
+	// text for every keyword of every rule.
+	for _, word := range strings.Fields(text) {
+		cleaned := strings.Trim(word, ".,;:!?\"'()[]{}")
+		for _, rule := range m.words[cleaned] {
+			hit[rule] = true
+		}
+	}
+
+	for _, p := range m.phrases {
+		if !hit[p.rule] && strings.Contains(text, p.phrase) {
+			hit[p.rule] = true
+		}
+	}
+
+	for i, re := range m.patterns {
+		if re != nil && !hit[i] && re.MatchString(text) {
+			hit[i] = true
+		}
+	}
+
+	matched := make([]int, 0, len(hit))
+	for i, ok := range hit {
+		if ok {
+			matched = append(matched, i)
+		}
+	}
+	return matched
+}
@@ -4,6 +4,7 @@ import (
 	"fmt"
 	"sort"
 	"sync"
+	"sync/atomic"
 )
 
 func cloneServer(s *MCPServer) MCPServer {
@@ -17,24 +18,88 @@ func cloneServer(s *MCPServer) MCPServer {
 	return c
 }
 
-// Registry manages registered MCP servers.
+// Registry manages registered MCP servers. Reads go through an immutable
+// snapshot swapped in atomically on each mutation, so the route hot path
+// never takes a lock or clones the catalog.
 type Registry struct {
-	servers map[string]*MCPServer
-	mu      sync.RWMutex
+	mu   sync.Mutex // serializes writers only
+	snap atomic.Pointer[registrySnapshot]
+}
+
+// registrySnapshot is an immutable view of the registry. Derived slices
+// are deep-cloned once at build time: callers may mutate what List or
+// GetEnabled hand them without corrupting the authoritative servers map,
+// though such mutations are visible to other holders of the same snapshot.
+type registrySnapshot struct {
+	servers    map[string]*MCPServer
+	sortedAll  []MCPServer // priority desc
+	enabled    []MCPServer // priority desc, enabled only
+	totalTools int         // across enabled servers
+	generation uint64
+}
+
+func buildSnapshot(servers map[string]*MCPServer, generation uint64) *registrySnapshot {
+	snap := &registrySnapshot{
+		servers:    servers,
+		sortedAll:  make([]MCPServer, 0, len(servers)),
+		enabled:    make([]MCPServer, 0, len(servers)),
+		generation: generation,
+	}
+
+	for _, s := range servers {
+		snap.sortedAll = append(snap.sortedAll, cloneServer(s))
+		if s.Enabled {
+			snap.enabled = append(snap.enabled, cloneServer(s))
+			snap.totalTools += s.ToolCount
+		}
+	}
+
+	sort.Slice(snap.sortedAll, func(i, j int) bool {
+		return snap.sortedAll[i].Priority > snap.sortedAll[j].Priority
+	})
+	sort.Slice(snap.enabled, func(i, j int) bool {
+		return snap.enabled[i].Priority > snap.enabled[j].Priority
+	})
+
+	return snap
 }
 
 // NewRegistry creates a new MCP server registry.
 func NewRegistry() *Registry {
-	return &Registry{
-		servers: make(map[string]*MCPServer),
-	}
+	r := &Registry{}
+	r.snap.Store(buildSnapshot(make(map[string]*MCPServer), 0))
+	return r
 }
 
-// Register adds or updates an MCP server in the registry.
-func (r *Registry) Register(server MCPServer) error {
+// snapshot returns the current immutable view; used by the router to
+// avoid per-route cloning.
+func (r *Registry) snapshot() *registrySnapshot {
+	return r.snap.Load()
+}
+
+// mutate rebuilds the snapshot with fn applied to a copy of the servers
+// map. The copy means in-flight readers keep a consistent view.
+func (r *Registry) mutate(fn func(servers map[string]*MCPServer) error) error {
 	r.mu.Lock()
 	defer r.mu.Unlock()
 
+	old := r.snap.Load()
+	servers := make(map[string]*MCPServer, len(old.servers)+1)
+	for name, s := range old.servers {
+		c := cloneServer(s)
+		servers[name] = &c
+	}
+
+	if err := fn(servers); err != nil {
+		return err
+	}
+
+	r.snap.Store(buildSnapshot(servers, old.generation+1))
+	return nil
+}
+
+// Register adds or updates an MCP server in the registry.
+func (r *Registry) Register(server MCPServer) error {
 	if server.Name == "" {
 		return fmt.Errorf("server name cannot be empty")
 	}
@@ -44,16 +109,21 @@ func (r *Registry) Register(server MCPServer) error {
 		server.ToolCount = len(server.Tools)
 	}
 
-	r.servers[server.Name] = &server
-	return nil
+	return r.mutate(func(servers map[string]*MCPServer) error {
+		servers[server.Name] = &server
+		return nil
+	})
+}
+
+// Generation returns a counter that increments whenever the registry's
+// contents change; callers can use it to invalidate derived caches.
+func (r *Registry) Generation() uint64 {
+	return r.snap.Load().generation
 }
 
 // Get retrieves an MCP server by name.
 func (r *Registry) Get(name string) (*MCPServer, bool) {
-	r.mu.RLock()
-	defer r.mu.RUnlock()
-
-	server, ok := r.servers[name]
+	server, ok := r.snap.Load().servers[name]
 	if !ok {
 		return nil, false
 	}
@@ -65,89 +135,46 @@ func (r *Registry) Get(name string) (*MCPServer, bool) {
 
 // List returns all registered MCP servers sorted by priority (desc).
 func (r *Registry) List() []MCPServer {
-	r.mu.RLock()
-	defer r.mu.RUnlock()
-
-	servers := make([]MCPServer, 0, len(r.servers))
-	for _, s := range r.servers {
-		servers = append(servers, cloneServer(s))
-	}
-
-	// Sort by priority descending
-	sort.Slice(servers, func(i, j int) bool {
-		return servers[i].Priority > servers[j].Priority
-	})
-
-	return servers
+	return r.snap.Load().sortedAll
 }
 
 // Enable enables an MCP server.
 func (r *Registry) Enable(name string) error {
-	r.mu.Lock()
-	defer r.mu.Unlock()
-
-	server, ok := r.servers[name]
-	if !ok {
-		return fmt.Errorf("server %q not found", name)
-	}
-
-	server.Enabled = true
-	return nil
+	return r.mutate(func(servers map[string]*MCPServer) error {
+		server, ok := servers[name]
+		if !ok {
+			return fmt.Errorf("server %q not found", name)
+		}
+		server.Enabled = true
+		return nil
+	})
 }
 
 // Disable disables an MCP server.
 func (r *Registry) Disable(name string) error {
-	r.mu.Lock()
-	defer r.mu.Unlock()
-
-	server, ok := r.servers[name]
-	if !ok {
-		return fmt.Errorf("server %q not found", name)
-	}
-
-	server.Enabled = false
-	return nil
+	return r.mutate(func(servers map[string]*MCPServer) error {
+		server, ok := servers[name]
+		if !ok {
+			return fmt.Errorf("server %q not found", name)
+		}
+		server.Enabled = false
+		return nil
+	})
 }
 
 // Count returns the number of registered servers.
 func (r *Registry) Count() int {
-	r.mu.RLock()
-	defer r.mu.RUnlock()
-	return len(r.servers)
+	return len(r.snap.Load().servers)
 }
 
-// GetEnabled returns only enabled MCP servers.
+// GetEnabled returns only enabled MCP servers sorted by priority (desc).
 func (r *Registry) GetEnabled() []MCPServer {
-	r.mu.RLock()
-	defer r.mu.RUnlock()
-
-	servers := make([]MCPServer, 0)
-	for _, s := range r.servers {
-		if s.Enabled {
-			servers = append(servers, cloneServer(s))
-		}
-	}
-
-	// Sort by priority descending
-	sort.Slice(servers, func(i, j int) bool {
-		return servers[i].Priority > servers[j].Priority
-	})
-
-	return servers
+	return r.snap.Load().enabled
 }
 
 // TotalToolCount returns the total number of tools across all enabled servers.
 func (r *Registry) TotalToolCount() int {
-	r.mu.RLock()
-	defer r.mu.RUnlock()
-
-	total := 0
-	for _, s := range r.servers {
-		if s.Enabled {
-			total += s.ToolCount
-		}
-	}
-	return total
+	return r.snap.Load().totalTools
 }
 
 // RegisterDefaults registers a set of common MCP servers with estimated tool counts.
@@ -0,0 +1,122 @@
+package mcp
+
+import (
+	"container/list"
+	"hash/fnv"
+	"sync"
+)
+
+// routeCacheSize bounds the number of cached routing results. Repeat task
+// shapes ("run tests for X", "review PR Y") cluster into far fewer texts
+// than this in practice.
+const routeCacheSize = 256
+
+// routeCache is a concurrency-safe LRU of routing results keyed by a hash
+// of the lowercased task text. Entries carry the registry generation they
+// were computed against; the cache flushes itself when that changes, so
+// Enable/Disable/Register invalidate stale results automatically.
+type routeCache struct {
+	mu      sync.Mutex
+	entries map[uint64]*list.Element
+	order   *list.List // front = most recently used
+	gen     uint64     // registry generation the contents are valid for
+}
+
+type routeCacheEntry struct {
+	key    uint64
+	text   string // guards against hash collisions
+	result RoutingResult
+}
+
+func newRouteCache() *routeCache {
+	return &routeCache{
+		entries: make(map[uint64]*list.Element),
+		order:   list.New(),
+	}
+}
+
+func hashText(text string) uint64 {
+	h := fnv.New64a()
+	h.Write([]byte(text))
+	return h.Sum64()
+}
+
+// get returns a cached result for text, or nil on miss. The returned
+// result has its slices copied and its Task field zeroed; the caller
+// fills in the task.
+func (c *routeCache) get(text string, gen uint64) *RoutingResult {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	if gen != c.gen {
+		c.flushLocked(gen)
+		return nil
+	}
+
+	key := hashText(text)
+	elem, ok := c.entries[key]
+	if !ok {
+		return nil
+	}
+	entry := elem.Value.(*routeCacheEntry)
+	if entry.text != text {
+		return nil
+	}
+
+	c.order.MoveToFront(elem)
+	result := entry.result
+	result.SelectedMCPs = append([]MCPServer(nil), entry.result.SelectedMCPs...)
+	result.MatchedRules = append([]string(nil), entry.result.MatchedRules...)
+	return &result
+}
+
+// put stores a result for text. The stored copy's slices are cloned,
+// symmetric with get, so the entry shares nothing with the result the
+// caller keeps. The result's Task field is not cached.
+func (c *routeCache) put(text string, gen uint64, result *RoutingResult) {
+	c.mu.Lock()
+	defer c.mu.Unlock()
+
+	if gen != c.gen {
+		c.flushLocked(gen)
+	}
+
+	key := hashText(text)
+	if elem, ok := c.entries[key]; ok {
+		c.order.MoveToFront(elem)
+		entry := elem.Value.(*routeCacheEntry)
+		entry.text = text
+		entry.result = cachedCopy(result)
+		return
+	}
+
+	if c.order.Len() >= routeCacheSize {
+		oldest := c.order.Back()
+		if oldest != nil {
+			c.order.Remove(oldest)
+			delete(c.entries, oldest.Value.(*routeCacheEntry).key)
+		}
+	}
+
+	entry := &routeCacheEntry{key: key, text: text, result: cachedCopy(result)}
+	c.entries[key] = c.order.PushFront(entry)
+}
+
+// cachedCopy returns the cacheable form of a result: Task zeroed and the
+// slices cloned, so a caller mutating its returned result cannot poison
+// later cache hits.
+func cachedCopy(result *RoutingResult) RoutingResult {
+	c := *result
+	c.Task = Task{}
+	c.SelectedMCPs = append([]MCPServer(nil), result.SelectedMCPs...)
+	c.MatchedRules = append([]string(nil), result.MatchedRules...)
+	return c
+}
+
+// flushLocked drops all entries and adopts the new generation. Caller
+// must hold c.mu.
+func (c *routeCache) flushLocked(gen uint64) {
+	c.entries = make(map[uint64]*list.Element)
+	c.order.Init()
+	c.gen = gen
+}
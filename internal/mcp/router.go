@@ -2,7 +2,6 @@ package mcp
 
 import (
 	"context"
-	"regexp"
 	"sort"
 	"strings"
 )
@@ -21,6 +20,8 @@ type Router interface {
 type KeywordRouter struct {
 	config    *Config
 	registry  *Registry
+	matcher   *ruleMatcher
+	cache     *routeCache
 	overrides []string
 }
 
@@ -37,6 +38,8 @@ func NewRouter(cfg *Config, reg *Registry) *KeywordRouter {
 	return &KeywordRouter{
 		config:   cfg,
 		registry: reg,
+		matcher:  newRuleMatcher(cfg.Rules),
+		cache:    newRouteCache(),
 	}
 }
 
@@ -59,6 +62,14 @@ func (r *KeywordRouter) Route(ctx context.Context, task Task) (*RoutingResult, e
 	// Combine title and description for matching
 	text := strings.ToLower(task.Title + " " + task.Description)
 
+	// Repeat task shapes hit the cache; the registry generation keys
+	// invalidation so Enable/Disable/Register flush stale results.
+	gen := r.registry.Generation()
+	if cached := r.cache.get(text, gen); cached != nil {
+		cached.Task = task
+		return cached, nil
+	}
+
 	// Find matching rules
 	matchedMCPs := make(map[string]bool)
 	matchedRules := []string{}
@@ -70,17 +81,16 @@ func (r *KeywordRouter) Route(ctx context.Context, task Task) (*RoutingResult, e
 		}
 	}
 
-	// Apply keyword rules
-	for _, rule := range r.config.Rules {
-		if r.matchesRule(text, rule) {
-			matchedRules = append(matchedRules, strings.Join(rule.Keywords, ","))
-			for _, enable := range rule.Enable {
-				// Expand groups
-				expanded := r.config.ExpandGroup(enable)
-				for _, name := range expanded {
-					if !r.config.IsAlwaysOff(name) {
-						matchedMCPs[name] = true
-					}
+	// Apply keyword rules via the precompiled matcher
+	for _, idx := range r.matcher.match(text) {
+		rule := r.config.Rules[idx]
+		matchedRules = append(matchedRules, strings.Join(rule.Keywords, ","))
+		for _, enable := range rule.Enable {
+			// Expand groups
+			expanded := r.config.ExpandGroup(enable)
+			for _, name := range expanded {
+				if !r.config.IsAlwaysOff(name) {
+					matchedMCPs[name] = true
 				}
 			}
 		}
@@ -101,52 +111,15 @@ func (r *KeywordRouter) Route(ctx context.Context, task Task) (*RoutingResult, e
 	// Apply tool budget
 	selectedMCPs, totalTools, filteredTools := r.applyToolBudget(selectedMCPs)
 
-	return &RoutingResult{
+	result := &RoutingResult{
 		Task:          task,
 		SelectedMCPs:  selectedMCPs,
 		MatchedRules:  matchedRules,
 		TotalTools:    totalTools,
 		FilteredTools: filteredTools,
-	}, nil
-}
-
-// matchesRule checks if text matches a routing rule.
-func (r *KeywordRouter) matchesRule(text string, rule RoutingRule) bool {
-	// Check pattern first if specified
-	if rule.Pattern != "" {
-		matched, err := regexp.MatchString(rule.Pattern, text)
-		if err == nil && matched {
-			return true
-		}
-	}
-
-	// Check keywords with word boundary matching
-	for _, keyword := range rule.Keywords {
-		if containsWord(text, strings.ToLower(keyword)) {
-			return true
-		}
-	}
-
-	return false
-}
-
-// containsWord checks if text contains keyword as a whole word.
-func containsWord(text, keyword string) bool {
-	// For multi-word keywords like "pull request", use simple contains
-	if strings.Contains(keyword, " ") {
-		return strings.Contains(text, keyword)
-	}
-
-	// For single words, check word boundaries
-	words := strings.Fields(text)
-	for _, word := range words {
-		// Clean punctuation from word
-		cleaned := strings.Trim(word, ".,;:!?\"'()[]{}")
-		if cleaned == keyword {
-			return true
-		}
 	}
-	return false
+	r.cache.put(text, gen, result)
+	return result, nil
 }
 
 // routeWithOverrides returns MCPs based on manual overrides.
@@ -176,12 +149,16 @@ func (r *KeywordRouter) routeWithOverrides(task Task) (*RoutingResult, error) {
 }
 
 // buildMCPList converts a map of matched names to a sorted list of MCPs.
+// It reads from the registry snapshot, cloning only the matched servers so
+// routed results never alias the authoritative map: the cost is bounded by
+// the selection size, not the catalog.
 func (r *KeywordRouter) buildMCPList(matched map[string]bool) []MCPServer {
 	mcps := make([]MCPServer, 0, len(matched))
 
+	snap := r.registry.snapshot()
 	for name := range matched {
-		if mcp, ok := r.registry.Get(name); ok && mcp.Enabled {
-			mcps = append(mcps, *mcp)
+		if mcp, ok := snap.servers[name]; ok && mcp.Enabled {
+			mcps = append(mcps, cloneServer(mcp))
 		}
 	}
 
@@ -241,6 +218,8 @@ func (r *KeywordRouter) Override(mcps []string) Router {
 	return &KeywordRouter{
 		config:    r.config,
 		registry:  r.registry,
+		matcher:   r.matcher,
+		cache:     r.cache,
 		overrides: mcps,
 	}
 }
@@ -192,6 +192,130 @@ func TestKeywordRouter_Disabled(t *testing.T) {
 	}
 }
 
+func TestKeywordRouter_CacheInvalidatedByRegistry(t *testing.T) {
+	cfg := DefaultConfig()
+	reg := NewRegistry()
+	reg.RegisterDefaults()
+
+	router := NewRouter(cfg, reg)
+
+	task := Task{ID: "test-1", Title: "Create a GitHub PR"}
+	first, err := router.Route(context.Background(), task)
+	if err != nil {
+		t.Fatalf("Route() error = %v", err)
+	}
+
+	// Same text routed again should carry the new task identity
+	task2 := Task{ID: "test-2", Title: "Create a GitHub PR"}
+	second, err := router.Route(context.Background(), task2)
+	if err != nil {
+		t.Fatalf("Route() error = %v", err)
+	}
+	if second.Task.ID != "test-2" {
+		t.Errorf("Cached result kept stale task ID %q", second.Task.ID)
+	}
+	if len(second.SelectedMCPs) != len(first.SelectedMCPs) {
+		t.Errorf("Cached result differs: %d vs %d MCPs", len(second.SelectedMCPs), len(first.SelectedMCPs))
+	}
+
+	// Disabling a selected MCP must invalidate the cached result
+	if err := reg.Disable("github"); err != nil {
+		t.Fatalf("Disable() error = %v", err)
+	}
+	third, err := router.Route(context.Background(), task)
+	if err != nil {
+		t.Fatalf("Route() error = %v", err)
+	}
+	for _, mcp := range third.SelectedMCPs {
+		if mcp.Name == "github" {
+			t.Error("Disabled MCP still returned from cache")
+		}
+	}
+}
+
+func TestKeywordRouter_ResultsDoNotAliasCacheOrRegistry(t *testing.T) {
+	cfg := DefaultConfig()
+	reg := NewRegistry()
+	reg.RegisterDefaults()
+
+	router := NewRouter(cfg, reg)
+
+	task := Task{ID: "test-1", Title: "Create a GitHub PR"}
+	first, err := router.Route(context.Background(), task)
+	if err != nil {
+		t.Fatalf("Route() error = %v", err)
+	}
+	if len(first.SelectedMCPs) == 0 {
+		t.Fatal("Expected at least one selected MCP")
+	}
+
+	// Mutate the miss-path result; the cached entry and the registry must
+	// not see it
+	name := first.SelectedMCPs[0].Name
+	first.SelectedMCPs[0].Tools = nil
+	first.SelectedMCPs[0].Name = "mutated"
+	first.MatchedRules = append(first.MatchedRules[:0], "mutated")
+
+	second, err := router.Route(context.Background(), task)
+	if err != nil {
+		t.Fatalf("Route() error = %v", err)
+	}
+	if second.SelectedMCPs[0].Name == "mutated" {
+		t.Error("Mutating a returned result poisoned the cached entry")
+	}
+	for _, rule := range second.MatchedRules {
+		if rule == "mutated" {
+			t.Error("Mutating returned matched rules poisoned the cached entry")
+		}
+	}
+
+	authoritative, ok := reg.Get(name)
+	if !ok {
+		t.Fatalf("Get(%q) did not find the server", name)
+	}
+	if len(authoritative.Tools) == 0 {
+		t.Error("Mutating a routed server's tools corrupted the registry")
+	}
+}
+
+func TestRuleMatcher_Compiled(t *testing.T) {
+	rules := []RoutingRule{
+		{Keywords: []string{"github", "pull request"}},
+		{Keywords: []string{"deploy"}, Pattern: `ship(ping)? to prod`},
+		{Keywords: []string{"sql"}, Pattern: `(`}, // invalid pattern is skipped
+	}
+	m := newRuleMatcher(rules)
+
+	tests := []struct {
+		name    string
+		text    string
+		matched []int
+	}{
+		{"single word with punctuation", "open the github, please", []int{0}},
+		{"multi-word phrase", "review my pull request today", []int{0}},
+		{"word boundary respected", "githubber is not github", []int{0}},
+		{"no partial word match", "mysql is not sql-adjacent", nil},
+		{"pattern match", "shipping to prod tonight", []int{1}},
+		{"keyword and pattern same rule", "deploy by shipping to prod", []int{1}},
+		{"invalid pattern falls back to keywords", "run the sql migration", []int{2}},
+		{"multiple rules", "deploy the github app", []int{0, 1}},
+	}
+
+	for _, tt := range tests {
+		t.Run(tt.name, func(t *testing.T) {
+			got := m.match(tt.text)
+			if len(got) != len(tt.matched) {
+				t.Fatalf("match(%q) = %v, want %v", tt.text, got, tt.matched)
+			}
+			for i := range got {
+				if got[i] != tt.matched[i] {
+					t.Fatalf("match(%q) = %v, want %v", tt.text, got, tt.matched)
+				}
+			}
+		})
+	}
+}
+
 func TestRegistry_BasicOperations(t *testing.T) {
 	reg := NewRegistry()
 
@@ -319,6 +443,48 @@ func TestRegistry_ReturnsDeepCopies(t *testing.T) {
 	}
 }
 
+func TestRegistry_SnapshotIsolation(t *testing.T) {
+	reg := NewRegistry()
+	reg.RegisterDefaults()
+
+	before := reg.GetEnabled()
+
+	if err := reg.Disable("github"); err != nil {
+		t.Fatalf("Disable() error = %v", err)
+	}
+
+	// The slice captured before the mutation is an older snapshot and
+	// must still contain the server.
+	found := false
+	for _, s := range before {
+		if s.Name == "github" {
+			found = true
+		}
+	}
+	if !found {
+		t.Error("pre-mutation snapshot should still contain github")
+	}
+
+	for _, s := range reg.GetEnabled() {
+		if s.Name == "github" {
+			t.Error("post-mutation snapshot should not contain github")
+		}
+	}
+
+	// Derived counts must track the mutation too
+	gh, _ := reg.Get("github")
+	want := 0
+	for _, s := range reg.GetEnabled() {
+		want += s.ToolCount
+	}
+	if reg.TotalToolCount() != want {
+		t.Errorf("TotalToolCount() = %d, want %d", reg.TotalToolCount(), want)
+	}
+	if gh.Enabled {
+		t.Error("Get() should reflect the disable")
+	}
+}
+
 func TestConfig_SaveLoadRoundTrip(t *testing.T) {
 	tmp := t.TempDir()
 	path := filepath.Join(tmp, "mcp.yaml")
@@ -0,0 +1,208 @@
+// Package metrics provides lightweight in-process instrumentation exposed
+// in the Prometheus text format. It avoids pulling in a client library:
+// counters and histograms are atomic and safe to update on hot paths, and
+// the daemon serves them on /metrics.
+package metrics
+
+import (
+	"fmt"
+	"math"
+	"net/http"
+	"sort"
+	"strconv"
+	"sync"
+	"sync/atomic"
+)
+
+// DefBuckets covers latencies from sub-millisecond store queries to
+// multi-second worker runs.
+var DefBuckets = []float64{0.0005, 0.001, 0.0025, 0.005, 0.01, 0.025, 0.05, 0.1, 0.25, 0.5, 1, 2.5, 5, 10}
+
+// Counter is a monotonically increasing counter.
+type Counter struct {
+	name string
+	help string
+	v    atomic.Int64
+}
+
+// Inc adds one to the counter.
+func (c *Counter) Inc() {
+	c.v.Add(1)
+}
+
+// Add adds n to the counter.
+func (c *Counter) Add(n int64) {
+	c.v.Add(n)
+}
+
+// Value returns the current count.
+func (c *Counter) Value() int64 {
+	return c.v.Load()
+}
+
+// Histogram records observations into fixed cumulative buckets.
+type Histogram struct {
+	name    string
+	help    string
+	labels  string // pre-rendered label pairs, "" when unlabelled
+	buckets []float64
+	counts  []atomic.Int64 // one per bucket, plus +Inf at the end
+	sum     atomic.Uint64  // float64 bits
+	count   atomic.Int64
+}
+
+// Observe records a value (typically seconds).
+func (h *Histogram) Observe(v float64) {
+	idx := sort.SearchFloat64s(h.buckets, v)
+	h.counts[idx].Add(1)
+	h.count.Add(1)
+	for {
+		old := h.sum.Load()
+		next := math.Float64bits(math.Float64frombits(old) + v)
+		if h.sum.CompareAndSwap(old, next) {
+			return
+		}
+	}
+}
+
+// HistogramVec is a set of histograms partitioned by one label.
+type HistogramVec struct {
+	name    string
+	help    string
+	label   string
+	buckets []float64
+
+	mu       sync.Mutex
+	children map[string]*Histogram
+}
+
+// With returns the histogram for the given label value, creating it on
+// first use.
+func (v *HistogramVec) With(value string) *Histogram {
+	v.mu.Lock()
+	defer v.mu.Unlock()
+
+	if h, ok := v.children[value]; ok {
+		return h
+	}
+	h := &Histogram{
+		name:    v.name,
+		help:    v.help,
+		labels:  v.label + "=" + strconv.Quote(value),
+		buckets: v.buckets,
+		counts:  make([]atomic.Int64, len(v.buckets)+1),
+	}
+	v.children[value] = h
+	return h
+}
+
+// Registry holds registered metrics and renders them for scraping.
+type Registry struct {
+	mu         sync.Mutex
+	counters   []*Counter
+	histograms []*Histogram
+	vecs       []*HistogramVec
+}
+
+// NewRegistry creates an empty registry.
+func NewRegistry() *Registry {
+	return &Registry{}
+}
+
+var defaultRegistry = NewRegistry()
+
+// NewCounter registers a counter in the default registry.
+func NewCounter(name, help string) *Counter {
+	c := &Counter{name: name, help: help}
+	defaultRegistry.mu.Lock()
+	defaultRegistry.counters = append(defaultRegistry.counters, c)
+	defaultRegistry.mu.Unlock()
+	return c
+}
+
+// NewHistogram registers an unlabelled histogram in the default registry.
+func NewHistogram(name, help string, buckets []float64) *Histogram {
+	h := &Histogram{
+		name:    name,
+		help:    help,
+		buckets: buckets,
+		counts:  make([]atomic.Int64, len(buckets)+1),
+	}
+	defaultRegistry.mu.Lock()
+	defaultRegistry.histograms = append(defaultRegistry.histograms, h)
+	defaultRegistry.mu.Unlock()
+	return h
+}
+
+// NewHistogramVec registers a single-label histogram family in the
+// default registry.
+func NewHistogramVec(name, help, label string, buckets []float64) *HistogramVec {
+	v := &HistogramVec{
+		name:     name,
+		help:     help,
+		label:    label,
+		buckets:  buckets,
+		children: make(map[string]*Histogram),
+	}
+	defaultRegistry.mu.Lock()
+	defaultRegistry.vecs = append(defaultRegistry.vecs, v)
+	defaultRegistry.mu.Unlock()
+	return v
+}
+
+// Handler serves the default registry in Prometheus text format.
+func Handler() http.Handler {
+	return http.HandlerFunc(func(w http.ResponseWriter, r *http.Request) {
+		w.Header().Set("Content-Type", "text/plain; version=0.0.4; charset=utf-8")
+		defaultRegistry.write(w)
+	})
+}
+
+func (r *Registry) write(w http.ResponseWriter) {
+	r.mu.Lock()
+	defer r.mu.Unlock()
+
+	for _, c := range r.counters {
+		fmt.Fprintf(w, "# HELP %s %s\n# TYPE %s counter\n%s %d\n", c.name, c.help, c.name, c.name, c.Value())
+	}
+	for _, h := range r.histograms {
+		fmt.Fprintf(w, "# HELP %s %s\n# TYPE %s histogram\n", h.name, h.help, h.name)
+		h.write(w)
+	}
+	for _, v := range r.vecs {
+		fmt.Fprintf(w, "# HELP %s %s\n# TYPE %s histogram\n", v.name, v.help, v.name)
+		v.mu.Lock()
+		values := make([]string, 0, len(v.children))
+		for value := range v.children {
+			values = append(values, value)
+		}
+		sort.Strings(values)
+		for _, value := range values {
+			v.children[value].write(w)
+		}
+		v.mu.Unlock()
+	}
+}
+
+func (h *Histogram) write(w http.ResponseWriter) {
+	bucketPrefix := ""
+	sumSuffix := ""
+	if h.labels != "" {
+		bucketPrefix = h.labels + ","
+		sumSuffix = "{" + h.labels + "}"
+	}
+
+	cumulative := int64(0)
+	for i, bound := range h.buckets {
+		cumulative += h.counts[i].Load()
+		fmt.Fprintf(w, "%s_bucket{%sle=%q} %d\n", h.name, bucketPrefix, formatBound(bound), cumulative)
+	}
+	cumulative += h.counts[len(h.buckets)].Load()
+	fmt.Fprintf(w, "%s_bucket{%sle=\"+Inf\"} %d\n", h.name, bucketPrefix, cumulative)
+	fmt.Fprintf(w, "%s_sum%s %g\n", h.name, sumSuffix, math.Float64frombits(h.sum.Load()))
+	fmt.Fprintf(w, "%s_count%s %d\n", h.name, sumSuffix, h.count.Load())
+}
+
+func formatBound(b float64) string {
+	return strconv.FormatFloat(b, 'g', -1, 64)
+}
@@ -0,0 +1,69 @@
+package metrics
+
+import (
+	"net/http/httptest"
+	"strings"
+	"testing"
+)
+
+func TestCounterAndHistogramExposition(t *testing.T) {
+	c := NewCounter("test_ops_total", "Test operations.")
+	c.Inc()
+	c.Add(2)
+	if c.Value() != 3 {
+		t.Fatalf("Counter value = %d, want 3", c.Value())
+	}
+
+	h := NewHistogram("test_latency_seconds", "Test latency.", []float64{0.01, 0.1, 1})
+	h.Observe(0.005)
+	h.Observe(0.05)
+	h.Observe(5) // lands in +Inf
+
+	v := NewHistogramVec("test_query_seconds", "Test query latency.", "op", []float64{0.01, 0.1})
+	v.With("claim").Observe(0.02)
+	v.With("claim").Observe(0.02)
+	v.With("list").Observe(0.001)
+
+	rec := httptest.NewRecorder()
+	Handler().ServeHTTP(rec, httptest.NewRequest("GET", "/metrics", nil))
+	body := rec.Body.String()
+
+	expected := []string{
+		"# TYPE test_ops_total counter",
+		"test_ops_total 3",
+		"# TYPE test_latency_seconds histogram",
+		`test_latency_seconds_bucket{le="0.01"} 1`,
+		`test_latency_seconds_bucket{le="0.1"} 2`,
+		`test_latency_seconds_bucket{le="+Inf"} 3`,
+		"test_latency_seconds_count 3",
+		`test_query_seconds_bucket{op="claim",le="0.1"} 2`,
+		`test_query_seconds_count{op="claim"} 2`,
+		`test_query_seconds_count{op="list"} 1`,
+	}
+	for _, want := range expected {
+		if !strings.Contains(body, want) {
+			t.Errorf("Exposition missing %q\n%s", want, body)
+		}
+	}
+
+	if ct := rec.Header().Get("Content-Type"); !strings.HasPrefix(ct, "text/plain") {
+		t.Errorf("Content-Type = %q, want text/plain", ct)
+	}
+}
+
+func TestHistogramBucketBoundaries(t *testing.T) {
+	h := NewHistogram("test_bounds_seconds", "Boundary behavior.", []float64{1})
+	h.Observe(1) // values equal to a bound count as <= bound
+	h.Observe(1.5)
+
+	rec := httptest.NewRecorder()
+	Handler().ServeHTTP(rec, httptest.NewRequest("GET", "/metrics", nil))
+	body := rec.Body.String()
+
+	if !strings.Contains(body, `test_bounds_seconds_bucket{le="1"} 1`) {
+		t.Errorf("Value equal to bound should land in that bucket\n%s", body)
+	}
+	if !strings.Contains(body, `test_bounds_seconds_bucket{le="+Inf"} 2`) {
+		t.Errorf("All observations should be cumulative in +Inf\n%s", body)
+	}
+}
@@ -15,11 +15,15 @@ const (
 )
 
 // Task represents a unit of work in the control plane.
+// Higher Priority values are claimed first; ties fall back to creation order.
+// Deadline, when set, escalates the task's priority as it approaches.
 type Task struct {
 	ID          string     `json:"id"`
 	Title       string     `json:"title"`
 	Description string     `json:"description"`
 	Status      TaskStatus `json:"status"`
+	Priority    int        `json:"priority"`
+	Deadline    *time.Time `json:"deadline,omitempty"`
 	CreatedAt   time.Time  `json:"created_at"`
 	UpdatedAt   time.Time  `json:"updated_at"`
 	ClaimedBy   string     `json:"claimed_by,omitempty"`
@@ -70,6 +74,15 @@ type PDREntry struct {
 	Timestamp  time.Time `json:"timestamp"`
 }
 
+// PDRRollup is a daily aggregate of compacted PDR records: how many times
+// each (action, outcome) pair occurred on a given day.
+type PDRRollup struct {
+	Day     string `json:"day"` // YYYY-MM-DD
+	Action  string `json:"action"`
+	Outcome string `json:"outcome"`
+	Count   int    `json:"count"`
+}
+
 // MemoryItem represents a memory/knowledge snippet.
 type MemoryItem struct {
 	ID        string    `json:"id"`
@@ -0,0 +1,59 @@
+package scheduler
+
+import (
+	"path/filepath"
+	"testing"
+	"time"
+
+	"github.com/fentz26/neona/internal/audit"
+	"github.com/fentz26/neona/internal/models"
+	"github.com/fentz26/neona/internal/store"
+)
+
+// BenchmarkEnqueueToComplete measures end-to-end latency from task creation
+// through claim, dispatch, and worker completion on a running scheduler with
+// a stub connector.
+func BenchmarkEnqueueToComplete(b *testing.B) {
+	dbPath := filepath.Join(b.TempDir(), "bench.db")
+	s, err := store.New(dbPath)
+	if err != nil {
+		b.Fatalf("Failed to create store: %v", err)
+	}
+	defer s.Close()
+
+	pdr := audit.NewPDRWriter(s)
+	conn := &mockConnector{name: "bench"}
+	cfg := &Config{
+		GlobalMax:   8,
+		ByConnector: map[string]int{"bench": 8},
+	}
+
+	sch := New(s, pdr, conn, cfg)
+	sch.workerDuration = time.Millisecond
+	sch.Start()
+	defer sch.Stop()
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		task, err := s.CreateTask("Bench Task", "Description")
+		if err != nil {
+			b.Fatalf("CreateTask failed: %v", err)
+		}
+		sch.Notify()
+
+		deadline := time.Now().Add(10 * time.Second)
+		for {
+			got, err := s.GetTask(task.ID)
+			if err != nil {
+				b.Fatalf("GetTask failed: %v", err)
+			}
+			if got.Status == models.TaskStatusCompleted {
+				break
+			}
+			if time.Now().After(deadline) {
+				b.Fatalf("Task %s not completed in time (status %s)", task.ID, got.Status)
+			}
+			time.Sleep(time.Millisecond)
+		}
+	}
+}
@@ -11,11 +11,45 @@ import (
 	"github.com/fentz26/neona/internal/audit"
 	"github.com/fentz26/neona/internal/connectors"
 	"github.com/fentz26/neona/internal/mcp"
+	"github.com/fentz26/neona/internal/metrics"
 	"github.com/fentz26/neona/internal/models"
 	"github.com/fentz26/neona/internal/store"
-	"github.com/google/uuid"
 )
 
+// Hot-path instrumentation, served by the daemon on /metrics.
+var (
+	claimDuration = metrics.NewHistogram("neona_scheduler_claim_seconds",
+		"Latency of the batched pending-task claim.", metrics.DefBuckets)
+	dispatchLag = metrics.NewHistogram("neona_scheduler_dispatch_lag_seconds",
+		"Time between a task being claimed and its worker starting.", metrics.DefBuckets)
+	runDuration = metrics.NewHistogram("neona_worker_run_seconds",
+		"Worker run duration from start to completion.", metrics.DefBuckets)
+)
+
+const (
+	// leaseTTLSec is the lease TTL for dispatched tasks. It is deliberately
+	// short: the heartbeat keeps live workers' leases fresh, and a short TTL
+	// means stalled workers release their tasks quickly.
+	leaseTTLSec = 60
+	// heartbeatInterval is how often all active leases are renewed in one
+	// batched UPDATE.
+	heartbeatInterval = 15 * time.Second
+	// sweepInterval is how often expired claims are returned to pending.
+	sweepInterval = 30 * time.Second
+	// deadlineWindow is how far ahead of a task's deadline its priority is
+	// escalated so it jumps the pending queue in time.
+	deadlineWindow = 5 * time.Minute
+	// escalatedPriority is the floor priority given to tasks whose deadline
+	// is inside deadlineWindow.
+	escalatedPriority = 100
+)
+
+// EventSink receives scheduler lifecycle notifications (worker start/stop,
+// lease renewals, task recovery) for fan-out to interested clients.
+type EventSink interface {
+	Publish(eventType string, data interface{})
+}
+
 // WorkerInfo contains details about an active worker.
 type WorkerInfo struct {
 	WorkerID      string    `json:"worker_id"`
@@ -29,14 +63,17 @@ type WorkerInfo struct {
 
 // Scheduler manages task dispatching and worker pools.
 type Scheduler struct {
-	store     *store.Store
-	pdr       *audit.PDRWriter
-	connector connectors.Connector
-	config    *Config
+	store  *store.Store
+	pdr    *audit.PDRWriter
+	pool   []connectors.Connector
+	config *Config
 
 	// MCP router for tool selection
 	mcpRouter *mcp.KeywordRouter
 
+	// Optional sink for lifecycle events
+	events EventSink
+
 	// Worker pool state
 	mu              sync.Mutex
 	activeWorkers   int
@@ -48,6 +85,10 @@ type Scheduler struct {
 	cancel context.CancelFunc
 	wg     sync.WaitGroup
 
+	// wake is signalled when a new task is enqueued so the loop can
+	// dispatch immediately instead of waiting for the next tick.
+	wake chan struct{}
+
 	// Test configuration
 	workerDuration time.Duration
 }
@@ -63,12 +104,13 @@ func New(s *store.Store, pdr *audit.PDRWriter, conn connectors.Connector, cfg *C
 	return &Scheduler{
 		store:           s,
 		pdr:             pdr,
-		connector:       conn,
+		pool:            []connectors.Connector{conn},
 		config:          cfg,
 		connectorCounts: make(map[string]int),
 		workers:         make(map[string]*WorkerInfo),
 		ctx:             ctx,
 		cancel:          cancel,
+		wake:            make(chan struct{}, 1),
 		workerDuration:  5 * time.Second, // Default duration
 	}
 }
@@ -79,6 +121,27 @@ func (sch *Scheduler) SetMCPRouter(router *mcp.KeywordRouter) {
 	sch.mcpRouter = router
 }
 
+// SetEventSink sets the sink that receives worker and lease lifecycle events.
+// Must be called before Start() - not safe for concurrent use.
+func (sch *Scheduler) SetEventSink(sink EventSink) {
+	sch.events = sink
+}
+
+// publish emits a lifecycle event if a sink is configured.
+func (sch *Scheduler) publish(eventType string, data interface{}) {
+	if sch.events != nil {
+		sch.events.Publish(eventType, data)
+	}
+}
+
+// AddConnector adds a connector to the dispatch pool. Each connector gets its
+// own slot budget from the config, and new work is placed on whichever
+// connector currently has the most free slots.
+// Must be called before Start() - not safe for concurrent use.
+func (sch *Scheduler) AddConnector(conn connectors.Connector) {
+	sch.pool = append(sch.pool, conn)
+}
+
 // Start begins the scheduler loop.
 func (sch *Scheduler) Start() {
 	sch.mu.Lock()
@@ -94,8 +157,9 @@ func (sch *Scheduler) Start() {
 	}
 	sch.mu.Unlock()
 
-	sch.wg.Add(1)
+	sch.wg.Add(2)
 	go sch.schedulerLoop()
+	go sch.heartbeatLoop()
 	log.Println("Scheduler started")
 }
 
@@ -106,7 +170,18 @@ func (sch *Scheduler) Stop() {
 	log.Println("Scheduler stopped")
 }
 
-// schedulerLoop polls for pending tasks and dispatches them to workers.
+// Notify wakes the scheduler loop to dispatch newly enqueued tasks.
+// It never blocks; signals are coalesced if the loop is already pending a wake.
+func (sch *Scheduler) Notify() {
+	select {
+	case sch.wake <- struct{}{}:
+	default:
+	}
+}
+
+// schedulerLoop dispatches pending tasks to workers. It wakes immediately on
+// Notify (task enqueued) and keeps a slow ticker as a fallback sweep for
+// tasks that reappear without a notification (e.g. released or expired leases).
 func (sch *Scheduler) schedulerLoop() {
 	defer sch.wg.Done()
 
@@ -117,40 +192,87 @@ func (sch *Scheduler) schedulerLoop() {
 		select {
 		case <-sch.ctx.Done():
 			return
+		case <-sch.wake:
+			sch.drainPending()
 		case <-ticker.C:
-			sch.pollAndDispatch()
+			sch.drainPending()
 		}
 	}
 }
 
-// pollAndDispatch checks for pending tasks and dispatches them to workers.
-func (sch *Scheduler) pollAndDispatch() {
-	// Check if we have capacity for more workers
+// drainPending claims pending tasks up to available capacity in one batched
+// transaction and dispatches them all. A single wake can cover a burst of
+// enqueues, so one pass saturates the pool rather than claiming one task.
+//
+// Capacity spans the whole connector pool: each connector contributes its
+// remaining per-connector slots, bounded by the global limit. Claims are then
+// placed least-loaded-first, so an idle connector absorbs work that would
+// otherwise queue behind a busy one.
+func (sch *Scheduler) drainPending() {
+	// Compute free slots per connector under both global and connector limits
 	sch.mu.Lock()
-	if sch.activeWorkers >= sch.config.GlobalMax {
-		sch.mu.Unlock()
-		return
+	capacity := sch.config.GlobalMax - sch.activeWorkers
+	free := make(map[string]int, len(sch.pool))
+	poolFree := 0
+	for _, conn := range sch.pool {
+		name := conn.Name()
+		if _, seen := free[name]; seen {
+			continue
+		}
+		slots := sch.config.GetConnectorLimit(name) - sch.connectorCounts[name]
+		// Capacity-aware connectors know their own per-command-class
+		// saturation; respect it in addition to the static limit.
+		if ca, ok := conn.(connectors.CapacityAware); ok {
+			if cs := ca.FreeSlots(); cs < slots {
+				slots = cs
+			}
+		}
+		if slots > 0 {
+			free[name] = slots
+			poolFree += slots
+		}
 	}
+	sch.mu.Unlock()
 
-	connectorName := sch.connector.Name()
-	connectorLimit := sch.config.GetConnectorLimit(connectorName)
-	if sch.connectorCounts[connectorName] >= connectorLimit {
-		sch.mu.Unlock()
+	if poolFree < capacity {
+		capacity = poolFree
+	}
+	if capacity <= 0 {
 		return
 	}
-	sch.mu.Unlock()
 
-	// Attempt to atomically claim a task
-	workerID := uuid.New().String()
-	task, lease, err := sch.store.AtomicClaimTask(workerID, 300)
+	// Claim up to capacity in a single transaction
+	claimStart := time.Now()
+	claims, err := sch.store.AtomicClaimTasks("", capacity, leaseTTLSec)
 	if err != nil {
-		log.Printf("Error claiming task: %v", err)
+		log.Printf("Error claiming tasks: %v", err)
 		return
 	}
-	if task == nil {
-		// No pending tasks
-		return
+	claimDuration.Observe(time.Since(claimStart).Seconds())
+
+	for i := range claims {
+		// Place each claim on the connector with the most free slots
+		connectorName := ""
+		best := 0
+		for name, slots := range free {
+			if slots > best {
+				connectorName = name
+				best = slots
+			}
+		}
+		if connectorName == "" {
+			break
+		}
+		free[connectorName]--
+		sch.dispatch(claims[i].Task, claims[i].Lease, connectorName)
 	}
+}
+
+// dispatch records the dispatch, routes MCPs, and starts a worker for a
+// freshly claimed task. The lease holder ID doubles as the worker ID.
+func (sch *Scheduler) dispatch(task *models.Task, lease *models.Lease, connectorName string) {
+	workerID := lease.HolderID
+	claimedAt := time.Now()
 
 	// Emit PDR for dispatch
 	sch.pdr.Record("task.dispatch", map[string]interface{}{
@@ -202,21 +324,100 @@ func (sch *Scheduler) pollAndDispatch() {
 	}
 	sch.mu.Unlock()
 
+	sch.publish("worker.started", map[string]string{"worker_id": workerID, "task_id": task.ID, "connector": connectorName})
+
 	// Start worker in goroutine
 	sch.wg.Add(1)
-	go sch.runWorker(task, lease, workerID)
+	go func() {
+		dispatchLag.Observe(time.Since(claimedAt).Seconds())
+		sch.runWorker(task, lease, workerID, connectorName)
+	}()
+}
+
+// heartbeatLoop renews every active worker's lease in one batched UPDATE per
+// interval and periodically returns expired claims to pending and escalates
+// tasks approaching their deadline. One goroutine
+// covers the whole pool, so there are no per-worker timers and lease upkeep
+// costs one write transaction per beat regardless of worker count.
+func (sch *Scheduler) heartbeatLoop() {
+	defer sch.wg.Done()
+
+	heartbeat := time.NewTicker(heartbeatInterval)
+	defer heartbeat.Stop()
+	sweep := time.NewTicker(sweepInterval)
+	defer sweep.Stop()
+
+	for {
+		select {
+		case <-sch.ctx.Done():
+			return
+		case <-heartbeat.C:
+			sch.renewActiveLeases()
+		case <-sweep.C:
+			if escalated, err := sch.store.EscalateDueTasks(deadlineWindow, escalatedPriority); err != nil {
+				log.Printf("Error escalating due tasks: %v", err)
+			} else if escalated > 0 {
+				log.Printf("Escalated %d tasks approaching their deadline", escalated)
+			}
+
+			recovered, err := sch.store.RecoverExpiredTasks()
+			if err != nil {
+				log.Printf("Error recovering expired tasks: %v", err)
+				continue
+			}
+			if recovered > 0 {
+				log.Printf("Recovered %d orphaned tasks to pending", recovered)
+				sch.publish("task.recovered", map[string]interface{}{"count": recovered})
+				sch.Notify()
+			}
+		}
+	}
+}
+
+// renewActiveLeases extends all active workers' leases in a single UPDATE.
+func (sch *Scheduler) renewActiveLeases() {
+	expiresAt := time.Now().Add(leaseTTLSec * time.Second)
+
+	sch.mu.Lock()
+	leaseIDs := make([]string, 0, len(sch.workers))
+	for _, w := range sch.workers {
+		leaseIDs = append(leaseIDs, w.LeaseID)
+	}
+	sch.mu.Unlock()
+
+	if len(leaseIDs) == 0 {
+		return
+	}
+
+	if err := sch.store.RenewLeases(leaseIDs, leaseTTLSec); err != nil {
+		log.Printf("Error renewing leases: %v", err)
+		return
+	}
+
+	// Reflect the new expiry in the worker snapshots served by /workers
+	sch.mu.Lock()
+	for _, w := range sch.workers {
+		w.LeaseExpires = expiresAt
+	}
+	sch.mu.Unlock()
+
+	sch.publish("lease.renewed", map[string]interface{}{"count": len(leaseIDs), "expires_at": expiresAt})
 }
 
 // runWorker executes a task in a worker.
-func (sch *Scheduler) runWorker(task *models.Task, lease *models.Lease, workerID string) {
+func (sch *Scheduler) runWorker(task *models.Task, lease *models.Lease, workerID, connectorName string) {
 	defer sch.wg.Done()
+	runStart := time.Now()
 	defer func() {
+		runDuration.Observe(time.Since(runStart).Seconds())
 		// Decrement worker counts and remove from tracking
 		sch.mu.Lock()
 		sch.activeWorkers--
-		sch.connectorCounts[sch.connector.Name()]--
+		sch.connectorCounts[connectorName]--
 		delete(sch.workers, workerID)
 		sch.mu.Unlock()
+
+		sch.publish("worker.stopped", map[string]string{"worker_id": workerID, "task_id": task.ID})
 	}()
 
 	// If we exit early (cancel/error), make the task claimable again.
@@ -275,6 +275,95 @@ allClaimed:
 	}
 }
 
+func TestConnectorPoolSpreadsLoad(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	pdr := audit.NewPDRWriter(s)
+
+	cfg := &Config{
+		GlobalMax: 4,
+		ByConnector: map[string]int{
+			"alpha": 2,
+			"beta":  2,
+		},
+	}
+
+	sch := New(s, pdr, &mockConnector{name: "alpha"}, cfg)
+	sch.AddConnector(&mockConnector{name: "beta"})
+	sch.workerDuration = 10 * time.Second // Keep workers busy during the check
+
+	// Create enough tasks to fill both connectors
+	for i := 0; i < 4; i++ {
+		_, err := s.CreateTask("Task", "Description")
+		if err != nil {
+			t.Fatalf("Failed to create task: %v", err)
+		}
+	}
+
+	sch.Start()
+	defer sch.Stop()
+
+	// Poll until the pool is saturated or timeout
+	timeout := time.After(10 * time.Second)
+	ticker := time.NewTicker(100 * time.Millisecond)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-timeout:
+			t.Fatalf("Timeout waiting for pool to saturate: %v", sch.GetStats())
+		case <-ticker.C:
+			stats := sch.GetStats()
+			if stats["active_workers"].(int) == 4 {
+				counts := stats["connector_counts"].(map[string]int)
+				if counts["alpha"] != 2 || counts["beta"] != 2 {
+					t.Errorf("Expected load spread 2/2 across connectors, got %v", counts)
+				}
+				return
+			}
+		}
+	}
+}
+
+func TestNotifyDispatchesBeforeTick(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	pdr := audit.NewPDRWriter(s)
+	conn := &mockConnector{name: "test"}
+
+	sch := New(s, pdr, conn, DefaultConfig())
+	sch.Start()
+	defer sch.Stop()
+
+	task, err := s.CreateTask("Notified Task", "Description")
+	if err != nil {
+		t.Fatalf("Failed to create task: %v", err)
+	}
+	sch.Notify()
+
+	// The wake signal should dispatch well before the 1s fallback tick
+	deadline := time.After(500 * time.Millisecond)
+	ticker := time.NewTicker(10 * time.Millisecond)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-deadline:
+			t.Fatal("Task not dispatched before fallback tick")
+		case <-ticker.C:
+			got, err := s.GetTask(task.ID)
+			if err != nil {
+				t.Fatalf("Failed to get task: %v", err)
+			}
+			if got.Status == "claimed" {
+				return
+			}
+		}
+	}
+}
+
 func newTestStore(t *testing.T) *store.Store {
 	tmpDir := t.TempDir()
 	dbPath := filepath.Join(tmpDir, "test.db")
@@ -0,0 +1,270 @@
+package store
+
+import (
+	"compress/gzip"
+	"database/sql"
+	"encoding/json"
+	"fmt"
+	"io"
+	"log"
+	"os"
+	"path/filepath"
+	"time"
+
+	"github.com/fentz26/neona/internal/models"
+)
+
+const (
+	// archiveInterval is how often the background job looks for tasks to
+	// move into cold storage.
+	archiveInterval = time.Hour
+	// archiveRetention is how long finished tasks stay in the hot database
+	// before archival.
+	archiveRetention = 7 * 24 * time.Hour
+	// archiveBatch caps how many tasks one archival pass moves, so a large
+	// backlog is drained over several passes instead of one huge transaction.
+	archiveBatch = 500
+)
+
+// ArchivedTask is the unit stored in archive segments: a finished task with
+// its runs (output included) and lease history.
+type ArchivedTask struct {
+	Task   models.Task    `json:"task"`
+	Runs   []models.Run   `json:"runs,omitempty"`
+	Leases []models.Lease `json:"leases,omitempty"`
+}
+
+// archiveLoop periodically moves old finished tasks into archive segments
+// until Close. Keeping the hot tables to days of data keeps the claim and
+// list scans small regardless of how long the daemon has been running.
+func (s *Store) archiveLoop() {
+	defer s.archiveWG.Done()
+
+	ticker := time.NewTicker(archiveInterval)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-s.archiveStop:
+			return
+		case <-ticker.C:
+			cutoff := time.Now().UTC().Add(-archiveRetention)
+			n, err := s.ArchiveTasks(cutoff)
+			if err != nil {
+				log.Printf("Error archiving tasks: %v", err)
+			} else if n > 0 {
+				log.Printf("Archived %d finished tasks to cold storage", n)
+			}
+		}
+	}
+}
+
+// ArchiveTasks moves tasks that finished before cutoff — along with their
+// runs, run output, and leases — into an append-only gzip segment in the
+// archive directory, then deletes the hot rows in one transaction. The
+// segment name is recorded in archive_index so GetArchivedTask can find the
+// record later. Returns the number of tasks archived.
+func (s *Store) ArchiveTasks(cutoff time.Time) (int, error) {
+	defer observeQuery("archive_tasks")()
+
+	rows, err := s.rdb.Query(
+		`SELECT id FROM tasks WHERE status IN (?, ?) AND updated_at < ? LIMIT ?`,
+		models.TaskStatusCompleted, models.TaskStatusFailed, cutoff, archiveBatch,
+	)
+	if err != nil {
+		return 0, fmt.Errorf("query archivable tasks: %w", err)
+	}
+	var ids []string
+	for rows.Next() {
+		var id string
+		if err := rows.Scan(&id); err != nil {
+			rows.Close()
+			return 0, fmt.Errorf("scan task id: %w", err)
+		}
+		ids = append(ids, id)
+	}
+	rows.Close()
+	if err := rows.Err(); err != nil {
+		return 0, err
+	}
+	if len(ids) == 0 {
+		return 0, nil
+	}
+
+	records := make([]ArchivedTask, 0, len(ids))
+	for _, id := range ids {
+		record, err := s.buildArchiveRecord(id)
+		if err != nil {
+			return 0, err
+		}
+		records = append(records, *record)
+	}
+
+	segment := fmt.Sprintf("segment-%d.jsonl.gz", time.Now().UTC().UnixNano())
+	if err := s.writeArchiveSegment(segment, records); err != nil {
+		return 0, err
+	}
+
+	// Delete the hot rows and record the segment in one transaction; if it
+	// fails the segment file is removed and everything stays hot.
+	if err := s.dropArchivedRows(ids, segment); err != nil {
+		os.Remove(filepath.Join(s.archiveDir, segment))
+		return 0, err
+	}
+	return len(ids), nil
+}
+
+// buildArchiveRecord gathers everything the hot database holds for a task.
+func (s *Store) buildArchiveRecord(taskID string) (*ArchivedTask, error) {
+	task, err := s.GetTask(taskID)
+	if err != nil {
+		return nil, err
+	}
+	if task == nil {
+		return nil, fmt.Errorf("archive task %s: not found", taskID)
+	}
+
+	runs, err := s.GetRunsForTask(taskID)
+	if err != nil {
+		return nil, err
+	}
+	// Archived runs carry their output inline; the run_log_chunks rows are
+	// deleted with the rest of the hot data.
+	for i := range runs {
+		stdout, stderr, err := s.GetRunOutput(runs[i].ID)
+		if err != nil {
+			return nil, err
+		}
+		runs[i].Stdout = stdout
+		runs[i].Stderr = stderr
+	}
+
+	leaseRows, err := s.rdb.Query(
+		`SELECT id, task_id, holder_id, ttl_sec, expires_at, created_at FROM leases WHERE task_id = ?`,
+		taskID,
+	)
+	if err != nil {
+		return nil, fmt.Errorf("query leases: %w", err)
+	}
+	defer leaseRows.Close()
+
+	var leases []models.Lease
+	for leaseRows.Next() {
+		var lease models.Lease
+		if err := leaseRows.Scan(&lease.ID, &lease.TaskID, &lease.HolderID, &lease.TTLSec, &lease.ExpiresAt, &lease.CreatedAt); err != nil {
+			return nil, fmt.Errorf("scan lease: %w", err)
+		}
+		leases = append(leases, lease)
+	}
+	if err := leaseRows.Err(); err != nil {
+		return nil, err
+	}
+
+	return &ArchivedTask{Task: *task, Runs: runs, Leases: leases}, nil
+}
+
+// writeArchiveSegment writes the records as gzip-compressed JSON lines and
+// syncs the file before returning, so the hot rows are only deleted once the
+// archive copy is durable.
+func (s *Store) writeArchiveSegment(segment string, records []ArchivedTask) error {
+	if err := os.MkdirAll(s.archiveDir, 0755); err != nil {
+		return fmt.Errorf("create archive directory: %w", err)
+	}
+
+	f, err := os.OpenFile(filepath.Join(s.archiveDir, segment), os.O_CREATE|os.O_EXCL|os.O_WRONLY, 0644)
+	if err != nil {
+		return fmt.Errorf("create archive segment: %w", err)
+	}
+	defer f.Close()
+
+	gz := gzip.NewWriter(f)
+	enc := json.NewEncoder(gz)
+	for _, record := range records {
+		if err := enc.Encode(record); err != nil {
+			return fmt.Errorf("encode archive record: %w", err)
+		}
+	}
+	if err := gz.Close(); err != nil {
+		return fmt.Errorf("flush archive segment: %w", err)
+	}
+	if err := f.Sync(); err != nil {
+		return fmt.Errorf("sync archive segment: %w", err)
+	}
+	return nil
+}
+
+// dropArchivedRows deletes the archived tasks' hot rows and records their
+// segment in archive_index, all in one transaction.
+func (s *Store) dropArchivedRows(ids []string, segment string) error {
+	now := time.Now().UTC()
+
+	tx, err := s.db.Begin()
+	if err != nil {
+		return fmt.Errorf("begin transaction: %w", err)
+	}
+	defer tx.Rollback()
+
+	for _, id := range ids {
+		if _, err := tx.Exec(
+			`INSERT INTO archive_index (task_id, segment, archived_at) VALUES (?, ?, ?)`,
+			id, segment, now,
+		); err != nil {
+			return fmt.Errorf("index archived task: %w", err)
+		}
+		if _, err := tx.Exec(
+			`DELETE FROM run_log_chunks WHERE run_id IN (SELECT id FROM runs WHERE task_id = ?)`, id,
+		); err != nil {
+			return fmt.Errorf("delete run log chunks: %w", err)
+		}
+		if _, err := tx.Exec(`DELETE FROM runs WHERE task_id = ?`, id); err != nil {
+			return fmt.Errorf("delete runs: %w", err)
+		}
+		if _, err := tx.Exec(`DELETE FROM leases WHERE task_id = ?`, id); err != nil {
+			return fmt.Errorf("delete leases: %w", err)
+		}
+		if _, err := tx.Exec(`DELETE FROM tasks WHERE id = ?`, id); err != nil {
+			return fmt.Errorf("delete task: %w", err)
+		}
+	}
+	return tx.Commit()
+}
+
+// GetArchivedTask looks a task up in cold storage: the archive_index row
+// names the segment, which is opened read-only and scanned for the record.
+// Returns nil when the task was never archived.
+func (s *Store) GetArchivedTask(taskID string) (*ArchivedTask, error) {
+	var segment string
+	err := s.rdb.QueryRow(`SELECT segment FROM archive_index WHERE task_id = ?`, taskID).Scan(&segment)
+	if err == sql.ErrNoRows {
+		return nil, nil
+	}
+	if err != nil {
+		return nil, fmt.Errorf("query archive index: %w", err)
+	}
+
+	f, err := os.Open(filepath.Join(s.archiveDir, segment))
+	if err != nil {
+		return nil, fmt.Errorf("open archive segment: %w", err)
+	}
+	defer f.Close()
+
+	gz, err := gzip.NewReader(f)
+	if err != nil {
+		return nil, fmt.Errorf("read archive segment: %w", err)
+	}
+	defer gz.Close()
+
+	dec := json.NewDecoder(gz)
+	for {
+		var record ArchivedTask
+		if err := dec.Decode(&record); err == io.EOF {
+			break
+		} else if err != nil {
+			return nil, fmt.Errorf("decode archive record: %w", err)
+		}
+		if record.Task.ID == taskID {
+			return &record, nil
+		}
+	}
+	return nil, fmt.Errorf("task %s indexed in segment %s but not found", taskID, segment)
+}
@@ -0,0 +1,98 @@
+package store
+
+import (
+	"fmt"
+	"path/filepath"
+	"sync"
+	"sync/atomic"
+	"testing"
+)
+
+func newBenchStore(b *testing.B) *Store {
+	b.Helper()
+	dbPath := filepath.Join(b.TempDir(), "bench.db")
+
+	s, err := New(dbPath)
+	if err != nil {
+		b.Fatalf("Failed to create store: %v", err)
+	}
+	return s
+}
+
+func BenchmarkCreateTask(b *testing.B) {
+	s := newBenchStore(b)
+	defer s.Close()
+
+	b.ResetTimer()
+	for i := 0; i < b.N; i++ {
+		if _, err := s.CreateTask("Bench Task", "Description"); err != nil {
+			b.Fatalf("CreateTask failed: %v", err)
+		}
+	}
+}
+
+func BenchmarkAtomicClaimTask(b *testing.B) {
+	for _, claimers := range []int{1, 8, 64} {
+		b.Run(fmt.Sprintf("claimers=%d", claimers), func(b *testing.B) {
+			s := newBenchStore(b)
+			defer s.Close()
+
+			// One pending task per iteration so every claim succeeds
+			for i := 0; i < b.N; i++ {
+				if _, err := s.CreateTask("Bench Task", "Description"); err != nil {
+					b.Fatalf("CreateTask failed: %v", err)
+				}
+			}
+
+			b.ResetTimer()
+			var next atomic.Int64
+			var wg sync.WaitGroup
+			for c := 0; c < claimers; c++ {
+				wg.Add(1)
+				go func() {
+					defer wg.Done()
+					for next.Add(1) <= int64(b.N) {
+						if _, _, err := s.AtomicClaimTask("bench", 300); err != nil {
+							b.Errorf("AtomicClaimTask failed: %v", err)
+							return
+						}
+					}
+				}()
+			}
+			wg.Wait()
+		})
+	}
+}
+
+func BenchmarkQueryMemory(b *testing.B) {
+	// 1M rows is impractical to seed with single-row inserts per run;
+	// 100k already shows how FTS latency scales with corpus size.
+	for _, rows := range []int{10000, 100000} {
+		b.Run(fmt.Sprintf("rows=%d", rows), func(b *testing.B) {
+			if rows > 10000 && testing.Short() {
+				b.Skip("skipping large corpus in short mode")
+			}
+
+			s := newBenchStore(b)
+			defer s.Close()
+
+			for i := 0; i < rows; i++ {
+				content := fmt.Sprintf("memory item %d about topic%d deployment notes", i, i%100)
+				if _, err := s.AddMemory("", content, "bench"); err != nil {
+					b.Fatalf("AddMemory failed: %v", err)
+				}
+			}
+
+			b.ResetTimer()
+			for i := 0; i < b.N; i++ {
+				items, err := s.QueryMemory(fmt.Sprintf("topic%d", i%100), "")
+				if err != nil {
+					b.Fatalf("QueryMemory failed: %v", err)
+				}
+				if len(items) == 0 {
+					b.Fatal("QueryMemory returned no rows")
+				}
+			}
+		})
+	}
+}
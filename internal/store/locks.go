@@ -0,0 +1,195 @@
+package store
+
+import (
+	"fmt"
+	"log"
+	"sync"
+	"time"
+
+	"github.com/fentz26/neona/internal/models"
+	"github.com/google/uuid"
+)
+
+// lockFlushInterval is how often the in-memory lock table is swept for
+// expired entries and persisted to SQLite when dirty.
+const lockFlushInterval = time.Second
+
+// lockTable is the authoritative in-memory lock state. The daemon is the
+// only writer to the database, so acquires and releases are plain map
+// operations under one mutex; SQLite only sees periodic write-behind
+// snapshots for crash recovery. This keeps lock churn off the single
+// writer connection that task claims share.
+type lockTable struct {
+	mu    sync.Mutex
+	byRes map[string]*models.Lock // resource_id -> active lock
+	byID  map[string]string       // lock id -> resource_id
+	dirty bool
+}
+
+// loadLocks restores unexpired locks from the database into memory; called
+// once at startup for crash recovery.
+func (s *Store) loadLocks() error {
+	s.locks.byRes = make(map[string]*models.Lock)
+	s.locks.byID = make(map[string]string)
+
+	rows, err := s.rdb.Query(
+		`SELECT id, resource_id, holder_id, lock_type, created_at, expires_at FROM locks WHERE expires_at > ?`,
+		time.Now().UTC(),
+	)
+	if err != nil {
+		return fmt.Errorf("load locks: %w", err)
+	}
+	defer rows.Close()
+
+	for rows.Next() {
+		var lock models.Lock
+		if err := rows.Scan(&lock.ID, &lock.ResourceID, &lock.HolderID, &lock.LockType, &lock.CreatedAt, &lock.ExpiresAt); err != nil {
+			return fmt.Errorf("scan lock: %w", err)
+		}
+		s.locks.byRes[lock.ResourceID] = &lock
+		s.locks.byID[lock.ID] = lock.ResourceID
+	}
+	return rows.Err()
+}
+
+// lockFlushLoop sweeps expired locks and persists the table until Close.
+func (s *Store) lockFlushLoop() {
+	defer s.lockWG.Done()
+
+	ticker := time.NewTicker(lockFlushInterval)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-s.lockStop:
+			return
+		case <-ticker.C:
+			s.sweepAndFlushLocks()
+		}
+	}
+}
+
+// sweepAndFlushLocks drops expired locks from memory and, when anything
+// changed since the last flush, rewrites the locks table in one
+// transaction.
+func (s *Store) sweepAndFlushLocks() {
+	now := time.Now().UTC()
+
+	s.locks.mu.Lock()
+	for res, lock := range s.locks.byRes {
+		if !lock.ExpiresAt.After(now) {
+			delete(s.locks.byID, lock.ID)
+			delete(s.locks.byRes, res)
+			s.locks.dirty = true
+		}
+	}
+	if !s.locks.dirty {
+		s.locks.mu.Unlock()
+		return
+	}
+	snapshot := make([]models.Lock, 0, len(s.locks.byRes))
+	for _, lock := range s.locks.byRes {
+		snapshot = append(snapshot, *lock)
+	}
+	s.locks.dirty = false
+	s.locks.mu.Unlock()
+
+	if err := s.persistLocks(snapshot); err != nil {
+		log.Printf("Error persisting locks: %v", err)
+		// Try again on the next tick
+		s.locks.mu.Lock()
+		s.locks.dirty = true
+		s.locks.mu.Unlock()
+	}
+}
+
+// persistLocks replaces the locks table with the given snapshot.
+func (s *Store) persistLocks(locks []models.Lock) error {
+	tx, err := s.db.Begin()
+	if err != nil {
+		return fmt.Errorf("begin transaction: %w", err)
+	}
+	defer tx.Rollback()
+
+	if _, err := tx.Exec(`DELETE FROM locks`); err != nil {
+		return fmt.Errorf("clear locks: %w", err)
+	}
+	for _, lock := range locks {
+		_, err := tx.Exec(
+			`INSERT INTO locks (id, resource_id, holder_id, lock_type, created_at, expires_at) VALUES (?, ?, ?, ?, ?, ?)`,
+			lock.ID, lock.ResourceID, lock.HolderID, lock.LockType, lock.CreatedAt, lock.ExpiresAt,
+		)
+		if err != nil {
+			return fmt.Errorf("insert lock: %w", err)
+		}
+	}
+	return tx.Commit()
+}
+
+// AcquireLock attempts to acquire a lock on a resource. The acquire is a
+// map operation against the in-memory table; persistence happens in the
+// background flush. If an unexpired lock exists, it returns
+// ErrResourceLocked.
+func (s *Store) AcquireLock(resourceID, holderID, lockType string, ttlSec int) (*models.Lock, error) {
+	defer observeQuery("acquire_lock")()
+
+	now := time.Now().UTC()
+
+	s.locks.mu.Lock()
+	defer s.locks.mu.Unlock()
+
+	if existing, ok := s.locks.byRes[resourceID]; ok {
+		if existing.ExpiresAt.After(now) {
+			lockConflicts.Inc()
+			return nil, ErrResourceLocked
+		}
+		// Expired: reclaim inline instead of waiting for the sweeper
+		delete(s.locks.byID, existing.ID)
+		delete(s.locks.byRes, resourceID)
+	}
+
+	lock := &models.Lock{
+		ID:         uuid.New().String(),
+		ResourceID: resourceID,
+		HolderID:   holderID,
+		LockType:   lockType,
+		CreatedAt:  now,
+		ExpiresAt:  now.Add(time.Duration(ttlSec) * time.Second),
+	}
+	s.locks.byRes[resourceID] = lock
+	s.locks.byID[lock.ID] = resourceID
+	s.locks.dirty = true
+
+	result := *lock
+	return &result, nil
+}
+
+// GetLock retrieves a lock by resource ID if it exists and is not expired.
+func (s *Store) GetLock(resourceID string) (*models.Lock, error) {
+	now := time.Now().UTC()
+
+	s.locks.mu.Lock()
+	defer s.locks.mu.Unlock()
+
+	lock, ok := s.locks.byRes[resourceID]
+	if !ok || !lock.ExpiresAt.After(now) {
+		return nil, nil
+	}
+	result := *lock
+	return &result, nil
+}
+
+// ReleaseLock releases a lock.
+func (s *Store) ReleaseLock(lockID string) error {
+	s.locks.mu.Lock()
+	defer s.locks.mu.Unlock()
+
+	resourceID, ok := s.locks.byID[lockID]
+	if !ok {
+		return nil // already released or expired
+	}
+	delete(s.locks.byID, lockID)
+	delete(s.locks.byRes, resourceID)
+	s.locks.dirty = true
+	return nil
+}
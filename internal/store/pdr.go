@@ -0,0 +1,228 @@
+package store
+
+import (
+	"database/sql"
+	"fmt"
+	"log"
+	"strings"
+	"time"
+
+	"github.com/fentz26/neona/internal/models"
+	"github.com/google/uuid"
+)
+
+const (
+	// pdrCompactInterval is how often the background loop rolls old PDR
+	// records up into daily aggregates.
+	pdrCompactInterval = time.Hour
+	// pdrRetention is how long raw PDR records are kept before compaction.
+	pdrRetention = 30 * 24 * time.Hour
+	// pdrQueryLimit caps a PDR query when the caller doesn't set a limit.
+	pdrQueryLimit = 200
+)
+
+// pdrCompactLoop periodically compacts PDR records older than the retention
+// window until Close. The pdr table is the fastest-growing one in the
+// database (two records per dispatched task); without compaction it
+// dominates both file size and backup time.
+func (s *Store) pdrCompactLoop() {
+	defer s.pdrWG.Done()
+
+	ticker := time.NewTicker(pdrCompactInterval)
+	defer ticker.Stop()
+
+	for {
+		select {
+		case <-s.pdrStop:
+			return
+		case <-ticker.C:
+			cutoff := time.Now().UTC().Add(-pdrRetention)
+			n, err := s.CompactPDR(cutoff)
+			if err != nil {
+				log.Printf("Error compacting pdr: %v", err)
+			} else if n > 0 {
+				log.Printf("Compacted %d pdr records into daily rollups", n)
+			}
+		}
+	}
+}
+
+// WritePDR writes a Process Decision Record.
+func (s *Store) WritePDR(action, inputsHash, outcome, taskID, details string) (*models.PDREntry, error) {
+	now := time.Now().UTC()
+	pdr := &models.PDREntry{
+		ID:         uuid.New().String(),
+		Action:     action,
+		InputsHash: inputsHash,
+		Outcome:    outcome,
+		TaskID:     taskID,
+		Details:    details,
+		Timestamp:  now,
+	}
+
+	_, err := s.prep.insertPDR.Exec(
+		pdr.ID, pdr.Action, pdr.InputsHash, pdr.Outcome, pdr.TaskID, pdr.Details, pdr.Timestamp,
+	)
+	if err != nil {
+		return nil, fmt.Errorf("insert pdr: %w", err)
+	}
+	return pdr, nil
+}
+
+// WritePDRBatch writes multiple Process Decision Records in a single
+// multi-row INSERT so a batch costs one write-lock acquisition instead of one
+// per record. Entries must arrive fully populated (ID and Timestamp set).
+func (s *Store) WritePDRBatch(entries []models.PDREntry) error {
+	if len(entries) == 0 {
+		return nil
+	}
+
+	var sb strings.Builder
+	sb.WriteString(`INSERT INTO pdr (id, action, inputs_hash, outcome, task_id, details, timestamp) VALUES `)
+	args := make([]interface{}, 0, len(entries)*7)
+	for i, e := range entries {
+		if i > 0 {
+			sb.WriteString(", ")
+		}
+		sb.WriteString("(?, ?, ?, ?, ?, ?, ?)")
+		args = append(args, e.ID, e.Action, e.InputsHash, e.Outcome, e.TaskID, e.Details, e.Timestamp)
+	}
+
+	if _, err := s.db.Exec(sb.String(), args...); err != nil {
+		return fmt.Errorf("insert pdr batch: %w", err)
+	}
+	return nil
+}
+
+// QueryPDR returns raw PDR records newest first, filtered by time range,
+// action, and task ID (zero values skip a filter). The filters run against
+// idx_pdr_action_ts and idx_pdr_task_id instead of scanning the table.
+// limit <= 0 applies the default cap.
+func (s *Store) QueryPDR(since, until time.Time, action, taskID string, limit int) ([]models.PDREntry, error) {
+	defer observeQuery("query_pdr")()
+
+	query := `SELECT id, action, inputs_hash, outcome, task_id, details, timestamp FROM pdr`
+	var conds []string
+	var args []interface{}
+
+	if !since.IsZero() {
+		conds = append(conds, `timestamp >= ?`)
+		args = append(args, since)
+	}
+	if !until.IsZero() {
+		conds = append(conds, `timestamp < ?`)
+		args = append(args, until)
+	}
+	if action != "" {
+		conds = append(conds, `action = ?`)
+		args = append(args, action)
+	}
+	if taskID != "" {
+		conds = append(conds, `task_id = ?`)
+		args = append(args, taskID)
+	}
+	if len(conds) > 0 {
+		query += ` WHERE ` + strings.Join(conds, " AND ")
+	}
+	if limit <= 0 {
+		limit = pdrQueryLimit
+	}
+	query += ` ORDER BY timestamp DESC LIMIT ?`
+	args = append(args, limit)
+
+	rows, err := s.rdb.Query(query, args...)
+	if err != nil {
+		return nil, fmt.Errorf("query pdr: %w", err)
+	}
+	defer rows.Close()
+
+	var entries []models.PDREntry
+	for rows.Next() {
+		var entry models.PDREntry
+		var entryTaskID, details sql.NullString
+		if err := rows.Scan(&entry.ID, &entry.Action, &entry.InputsHash, &entry.Outcome, &entryTaskID, &details, &entry.Timestamp); err != nil {
+			return nil, fmt.Errorf("scan pdr: %w", err)
+		}
+		entry.TaskID = entryTaskID.String
+		entry.Details = details.String
+		entries = append(entries, entry)
+	}
+	return entries, rows.Err()
+}
+
+// QueryPDRRollups returns the daily aggregates produced by compaction,
+// filtered by day range and action (zero values skip a filter).
+func (s *Store) QueryPDRRollups(since, until time.Time, action string) ([]models.PDRRollup, error) {
+	query := `SELECT day, action, outcome, count FROM pdr_rollups`
+	var conds []string
+	var args []interface{}
+
+	if !since.IsZero() {
+		conds = append(conds, `day >= ?`)
+		args = append(args, since.UTC().Format("2006-01-02"))
+	}
+	if !until.IsZero() {
+		conds = append(conds, `day <= ?`)
+		args = append(args, until.UTC().Format("2006-01-02"))
+	}
+	if action != "" {
+		conds = append(conds, `action = ?`)
+		args = append(args, action)
+	}
+	if len(conds) > 0 {
+		query += ` WHERE ` + strings.Join(conds, " AND ")
+	}
+	query += ` ORDER BY day DESC, action, outcome`
+
+	rows, err := s.rdb.Query(query, args...)
+	if err != nil {
+		return nil, fmt.Errorf("query pdr rollups: %w", err)
+	}
+	defer rows.Close()
+
+	var rollups []models.PDRRollup
+	for rows.Next() {
+		var r models.PDRRollup
+		if err := rows.Scan(&r.Day, &r.Action, &r.Outcome, &r.Count); err != nil {
+			return nil, fmt.Errorf("scan pdr rollup: %w", err)
+		}
+		rollups = append(rollups, r)
+	}
+	return rollups, rows.Err()
+}
+
+// CompactPDR rolls raw PDR records older than cutoff up into per-day
+// (action, outcome) counts in pdr_rollups and deletes them, all in one
+// transaction. Returns the number of raw records removed.
+func (s *Store) CompactPDR(cutoff time.Time) (int64, error) {
+	defer observeQuery("compact_pdr")()
+
+	tx, err := s.db.Begin()
+	if err != nil {
+		return 0, fmt.Errorf("begin transaction: %w", err)
+	}
+	defer tx.Rollback()
+
+	_, err = tx.Exec(`
+		INSERT INTO pdr_rollups (day, action, outcome, count)
+		SELECT date(timestamp), action, outcome, COUNT(*)
+		FROM pdr WHERE timestamp < ?
+		GROUP BY date(timestamp), action, outcome
+		ON CONFLICT(day, action, outcome) DO UPDATE SET count = count + excluded.count`,
+		cutoff,
+	)
+	if err != nil {
+		return 0, fmt.Errorf("roll up pdr: %w", err)
+	}
+
+	res, err := tx.Exec(`DELETE FROM pdr WHERE timestamp < ?`, cutoff)
+	if err != nil {
+		return 0, fmt.Errorf("delete compacted pdr: %w", err)
+	}
+	n, _ := res.RowsAffected()
+
+	if err := tx.Commit(); err != nil {
+		return 0, fmt.Errorf("commit transaction: %w", err)
+	}
+	return n, nil
+}
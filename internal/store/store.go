@@ -2,23 +2,84 @@
 package store
 
 import (
+	"bytes"
+	"compress/gzip"
 	"context"
 	"database/sql"
+	"encoding/base64"
 	"encoding/json"
 	"fmt"
+	"io"
 	"os"
 	"path/filepath"
+	"runtime"
 	"strings"
+	"sync"
 	"time"
 
+	"github.com/fentz26/neona/internal/metrics"
 	"github.com/fentz26/neona/internal/models"
 	"github.com/google/uuid"
 	_ "modernc.org/sqlite"
 )
 
+// Hot-path query instrumentation, served by the daemon on /metrics.
+var (
+	queryDuration = metrics.NewHistogramVec("neona_store_query_seconds",
+		"Store query latency by operation.", "op", metrics.DefBuckets)
+	leaseConflicts = metrics.NewCounter("neona_store_claim_conflicts_total",
+		"Claims rejected because the task already held an active lease.")
+	lockConflicts = metrics.NewCounter("neona_store_lock_conflicts_total",
+		"Lock acquisitions rejected because the resource was already locked.")
+)
+
+// observeQuery times a store operation: defer observeQuery("op")().
+func observeQuery(op string) func() {
+	start := time.Now()
+	return func() { queryDuration.With(op).Observe(time.Since(start).Seconds()) }
+}
+
 // Store provides access to the Neona SQLite database.
+//
+// Writes go through db, which is capped at one connection because SQLite
+// allows a single writer. Reads go through rdb, a separate multi-connection
+// pool: in WAL mode readers do not block on the writer, so queries no longer
+// queue behind in-flight write transactions.
 type Store struct {
-	db *sql.DB
+	db   *sql.DB
+	rdb  *sql.DB
+	prep preparedStmts
+
+	// locks is the authoritative in-memory lock table, persisted to the
+	// locks table by a background write-behind flush; see locks.go.
+	locks    lockTable
+	lockStop chan struct{}
+	lockWG   sync.WaitGroup
+
+	// pdrStop stops the background PDR compaction loop; see pdr.go.
+	pdrStop chan struct{}
+	pdrWG   sync.WaitGroup
+
+	// archiveDir holds cold-storage segments for finished tasks; the
+	// background archiver is in archive.go.
+	archiveDir  string
+	archiveStop chan struct{}
+	archiveWG   sync.WaitGroup
+}
+
+// preparedStmts caches *sql.Stmt handles for hot-path statements so the
+// driver parses and plans each of them once at startup instead of on every
+// call. Transactions reuse them via tx.Stmt.
+type preparedStmts struct {
+	insertTask       *sql.Stmt
+	getTask          *sql.Stmt // prepared on the writer for use inside claim transactions
+	getTaskRead      *sql.Stmt // prepared on the read pool for plain lookups
+	updateTaskStatus *sql.Stmt
+	claimOldest      *sql.Stmt
+	claimTask        *sql.Stmt
+	insertLease      *sql.Stmt
+	renewLease       *sql.Stmt
+	insertPDR        *sql.Stmt
 }
 
 // New creates a new Store and runs migrations.
@@ -39,17 +100,117 @@ func New(dbPath string) (*Store, error) {
 	db.SetMaxOpenConns(1) // SQLite only supports one writer at a time
 	db.SetMaxIdleConns(1)
 
-	s := &Store{db: db}
+	// Open a separate pool for reads; WAL readers don't contend with the writer
+	rdb, err := sql.Open("sqlite", dbPath+"?_journal_mode=WAL&_busy_timeout=5000&_synchronous=NORMAL")
+	if err != nil {
+		db.Close()
+		return nil, fmt.Errorf("open read pool: %w", err)
+	}
+	readConns := runtime.NumCPU()
+	if readConns > 8 {
+		readConns = 8
+	}
+	rdb.SetMaxOpenConns(readConns)
+	rdb.SetMaxIdleConns(readConns)
+
+	s := &Store{db: db, rdb: rdb, archiveDir: filepath.Join(dir, "archive")}
 	if err := s.migrate(); err != nil {
 		db.Close()
+		rdb.Close()
 		return nil, fmt.Errorf("migrate: %w", err)
 	}
+	if err := s.prepareStmts(); err != nil {
+		db.Close()
+		rdb.Close()
+		return nil, fmt.Errorf("prepare statements: %w", err)
+	}
+	if err := s.loadLocks(); err != nil {
+		db.Close()
+		rdb.Close()
+		return nil, fmt.Errorf("load locks: %w", err)
+	}
+
+	s.lockStop = make(chan struct{})
+	s.lockWG.Add(1)
+	go s.lockFlushLoop()
+
+	s.pdrStop = make(chan struct{})
+	s.pdrWG.Add(1)
+	go s.pdrCompactLoop()
+
+	s.archiveStop = make(chan struct{})
+	s.archiveWG.Add(1)
+	go s.archiveLoop()
 
 	return s, nil
 }
 
-// Close closes the database connection.
+// prepareStmts prepares the hot-path statements once for reuse.
+func (s *Store) prepareStmts() error {
+	for _, p := range []struct {
+		dst **sql.Stmt
+		sql string
+	}{
+		{&s.prep.insertTask, `INSERT INTO tasks (id, title, description, status, priority, deadline, created_at, updated_at) VALUES (?, ?, ?, ?, ?, ?, ?, ?)`},
+		{&s.prep.getTask, `SELECT id, title, description, status, priority, deadline, claimed_by, claimed_at, created_at, updated_at FROM tasks WHERE id = ?`},
+		{&s.prep.updateTaskStatus, `UPDATE tasks SET status = ?, updated_at = ? WHERE id = ?`},
+		{&s.prep.claimOldest, `UPDATE tasks SET status = ?, claimed_by = ?, claimed_at = ?, updated_at = ?
+			WHERE id = (SELECT id FROM tasks WHERE status = ? AND claimed_by IS NULL ORDER BY priority DESC, created_at ASC LIMIT 1)
+			RETURNING id, title, description, priority, created_at`},
+		{&s.prep.claimTask, `UPDATE tasks SET status = ?, claimed_by = ?, claimed_at = ?, updated_at = ? WHERE id = ? AND status = ?`},
+		{&s.prep.insertLease, `INSERT INTO leases (id, task_id, holder_id, ttl_sec, expires_at, created_at) VALUES (?, ?, ?, ?, ?, ?)`},
+		{&s.prep.renewLease, `UPDATE leases SET expires_at = ? WHERE id = ?`},
+		{&s.prep.insertPDR, `INSERT INTO pdr (id, action, inputs_hash, outcome, task_id, details, timestamp) VALUES (?, ?, ?, ?, ?, ?, ?)`},
+	} {
+		stmt, err := s.db.Prepare(p.sql)
+		if err != nil {
+			return fmt.Errorf("prepare %q: %w", p.sql, err)
+		}
+		*p.dst = stmt
+	}
+
+	stmt, err := s.rdb.Prepare(`SELECT id, title, description, status, priority, deadline, claimed_by, claimed_at, created_at, updated_at FROM tasks WHERE id = ?`)
+	if err != nil {
+		return fmt.Errorf("prepare read getTask: %w", err)
+	}
+	s.prep.getTaskRead = stmt
+
+	return nil
+}
+
+// Close stops the lock flusher, persists any pending lock state, then
+// closes the prepared statements and both database handles.
 func (s *Store) Close() error {
+	if s.archiveStop != nil {
+		close(s.archiveStop)
+		s.archiveWG.Wait()
+	}
+	if s.pdrStop != nil {
+		close(s.pdrStop)
+		s.pdrWG.Wait()
+	}
+	if s.lockStop != nil {
+		close(s.lockStop)
+		s.lockWG.Wait()
+		s.sweepAndFlushLocks()
+	}
+
+	for _, stmt := range []*sql.Stmt{
+		s.prep.insertTask,
+		s.prep.getTask,
+		s.prep.getTaskRead,
+		s.prep.updateTaskStatus,
+		s.prep.claimOldest,
+		s.prep.claimTask,
+		s.prep.insertLease,
+		s.prep.renewLease,
+		s.prep.insertPDR,
+	} {
+		if stmt != nil {
+			stmt.Close()
+		}
+	}
+	s.rdb.Close()
 	return s.db.Close()
 }
 
@@ -66,6 +227,8 @@ func (s *Store) migrate() error {
 		title TEXT NOT NULL,
 		description TEXT,
 		status TEXT NOT NULL DEFAULT 'pending',
+		priority INTEGER NOT NULL DEFAULT 0,
+		deadline DATETIME,
 		claimed_by TEXT,
 		claimed_at DATETIME,
 		created_at DATETIME NOT NULL,
@@ -104,6 +267,16 @@ func (s *Store) migrate() error {
 		FOREIGN KEY (task_id) REFERENCES tasks(id)
 	);
 
+	CREATE TABLE IF NOT EXISTS run_log_chunks (
+		run_id TEXT NOT NULL,
+		stream TEXT NOT NULL,
+		seq INTEGER NOT NULL,
+		data BLOB NOT NULL,
+		raw_len INTEGER NOT NULL,
+		PRIMARY KEY (run_id, stream, seq),
+		FOREIGN KEY (run_id) REFERENCES runs(id)
+	);
+
 	CREATE TABLE IF NOT EXISTS pdr (
 		id TEXT PRIMARY KEY,
 		action TEXT NOT NULL,
@@ -114,6 +287,20 @@ func (s *Store) migrate() error {
 		timestamp DATETIME NOT NULL
 	);
 
+	CREATE TABLE IF NOT EXISTS pdr_rollups (
+		day TEXT NOT NULL,
+		action TEXT NOT NULL,
+		outcome TEXT NOT NULL,
+		count INTEGER NOT NULL,
+		PRIMARY KEY (day, action, outcome)
+	);
+
+	CREATE TABLE IF NOT EXISTS archive_index (
+		task_id TEXT PRIMARY KEY,
+		segment TEXT NOT NULL,
+		archived_at DATETIME NOT NULL
+	);
+
 	CREATE TABLE IF NOT EXISTS memory_items (
 		id TEXT PRIMARY KEY,
 		task_id TEXT,
@@ -126,29 +313,87 @@ func (s *Store) migrate() error {
 	CREATE INDEX IF NOT EXISTS idx_leases_task_id ON leases(task_id);
 	CREATE INDEX IF NOT EXISTS idx_runs_task_id ON runs(task_id);
 	CREATE INDEX IF NOT EXISTS idx_memory_items_task_id ON memory_items(task_id);
+	CREATE INDEX IF NOT EXISTS idx_pdr_task_id ON pdr(task_id);
+	CREATE INDEX IF NOT EXISTS idx_pdr_action_ts ON pdr(action, timestamp);
+
+	CREATE VIRTUAL TABLE IF NOT EXISTS memory_fts USING fts5(
+		content,
+		content='memory_items',
+		content_rowid='rowid'
+	);
 	`
 
-	_, err := s.db.Exec(schema)
-	return err
+	if _, err := s.db.Exec(schema); err != nil {
+		return err
+	}
+
+	// Databases that predate the priority/deadline columns get them in place.
+	for _, col := range []struct{ name, ddl string }{
+		{"priority", `ALTER TABLE tasks ADD COLUMN priority INTEGER NOT NULL DEFAULT 0`},
+		{"deadline", `ALTER TABLE tasks ADD COLUMN deadline DATETIME`},
+	} {
+		var n int
+		if err := s.db.QueryRow(`SELECT count(*) FROM pragma_table_info('tasks') WHERE name = ?`, col.name).Scan(&n); err != nil {
+			return fmt.Errorf("inspect tasks schema: %w", err)
+		}
+		if n == 0 {
+			if _, err := s.db.Exec(col.ddl); err != nil {
+				return fmt.Errorf("add tasks.%s: %w", col.name, err)
+			}
+		}
+	}
+
+	// The claim path orders by priority first, so the pending index must lead
+	// with it; replace the old (status, created_at) partial index.
+	if _, err := s.db.Exec(`
+		DROP INDEX IF EXISTS idx_tasks_pending;
+		CREATE INDEX IF NOT EXISTS idx_tasks_pending_priority ON tasks(status, priority DESC, created_at) WHERE claimed_by IS NULL;
+	`); err != nil {
+		return fmt.Errorf("rebuild pending index: %w", err)
+	}
+
+	// Backfill the FTS index for databases that predate it. The index is
+	// external-content, so a rebuild repopulates it from memory_items.
+	var ftsCount, itemCount int
+	if err := s.db.QueryRow(`SELECT count(*) FROM memory_fts`).Scan(&ftsCount); err != nil {
+		return fmt.Errorf("count memory_fts: %w", err)
+	}
+	if err := s.db.QueryRow(`SELECT count(*) FROM memory_items`).Scan(&itemCount); err != nil {
+		return fmt.Errorf("count memory_items: %w", err)
+	}
+	if ftsCount == 0 && itemCount > 0 {
+		if _, err := s.db.Exec(`INSERT INTO memory_fts(memory_fts) VALUES('rebuild')`); err != nil {
+			return fmt.Errorf("rebuild memory_fts: %w", err)
+		}
+	}
+
+	return nil
 }
 
 // --- Task Operations ---
 
-// CreateTask inserts a new task.
+// CreateTask inserts a new task at the default priority with no deadline.
 func (s *Store) CreateTask(title, description string) (*models.Task, error) {
+	return s.CreateTaskWithPriority(title, description, 0, nil)
+}
+
+// CreateTaskWithPriority inserts a new task with an explicit priority and an
+// optional deadline (nil for none). Higher priorities are claimed first.
+func (s *Store) CreateTaskWithPriority(title, description string, priority int, deadline *time.Time) (*models.Task, error) {
 	now := time.Now().UTC()
 	task := &models.Task{
 		ID:          uuid.New().String(),
 		Title:       title,
 		Description: description,
 		Status:      models.TaskStatusPending,
+		Priority:    priority,
+		Deadline:    deadline,
 		CreatedAt:   now,
 		UpdatedAt:   now,
 	}
 
-	_, err := s.db.Exec(
-		`INSERT INTO tasks (id, title, description, status, created_at, updated_at) VALUES (?, ?, ?, ?, ?, ?)`,
-		task.ID, task.Title, task.Description, task.Status, task.CreatedAt, task.UpdatedAt,
+	_, err := s.prep.insertTask.Exec(
+		task.ID, task.Title, task.Description, task.Status, task.Priority, task.Deadline, task.CreatedAt, task.UpdatedAt,
 	)
 	if err != nil {
 		return nil, fmt.Errorf("insert task: %w", err)
@@ -156,16 +401,67 @@ func (s *Store) CreateTask(title, description string) (*models.Task, error) {
 	return task, nil
 }
 
+// TaskSpec describes one task in a bulk insert.
+type TaskSpec struct {
+	Title       string
+	Description string
+	Priority    int
+	Deadline    *time.Time
+}
+
+// CreateTasks inserts a batch of tasks in a single transaction, so a burst
+// enqueue costs one commit (and one WAL sync) instead of one per row.
+// Returns the created tasks in input order.
+func (s *Store) CreateTasks(specs []TaskSpec) ([]models.Task, error) {
+	if len(specs) == 0 {
+		return nil, nil
+	}
+	defer observeQuery("create_tasks")()
+
+	now := time.Now().UTC()
+
+	tx, err := s.db.Begin()
+	if err != nil {
+		return nil, fmt.Errorf("begin transaction: %w", err)
+	}
+	defer tx.Rollback()
+
+	insert := tx.Stmt(s.prep.insertTask)
+	tasks := make([]models.Task, 0, len(specs))
+	for _, spec := range specs {
+		task := models.Task{
+			ID:          uuid.New().String(),
+			Title:       spec.Title,
+			Description: spec.Description,
+			Status:      models.TaskStatusPending,
+			Priority:    spec.Priority,
+			Deadline:    spec.Deadline,
+			CreatedAt:   now,
+			UpdatedAt:   now,
+		}
+		_, err := insert.Exec(
+			task.ID, task.Title, task.Description, task.Status, task.Priority, task.Deadline, task.CreatedAt, task.UpdatedAt,
+		)
+		if err != nil {
+			return nil, fmt.Errorf("insert task: %w", err)
+		}
+		tasks = append(tasks, task)
+	}
+
+	if err := tx.Commit(); err != nil {
+		return nil, fmt.Errorf("commit transaction: %w", err)
+	}
+	return tasks, nil
+}
+
 // GetTask retrieves a task by ID.
 func (s *Store) GetTask(id string) (*models.Task, error) {
 	task := &models.Task{}
-	var claimedAt sql.NullTime
+	var deadline, claimedAt sql.NullTime
 	var claimedBy sql.NullString
 
-	err := s.db.QueryRow(
-		`SELECT id, title, description, status, claimed_by, claimed_at, created_at, updated_at FROM tasks WHERE id = ?`,
-		id,
-	).Scan(&task.ID, &task.Title, &task.Description, &task.Status, &claimedBy, &claimedAt, &task.CreatedAt, &task.UpdatedAt)
+	err := s.prep.getTaskRead.QueryRow(id).
+		Scan(&task.ID, &task.Title, &task.Description, &task.Status, &task.Priority, &deadline, &claimedBy, &claimedAt, &task.CreatedAt, &task.UpdatedAt)
 
 	if err == sql.ErrNoRows {
 		return nil, nil
@@ -173,6 +469,9 @@ func (s *Store) GetTask(id string) (*models.Task, error) {
 	if err != nil {
 		return nil, fmt.Errorf("query task: %w", err)
 	}
+	if deadline.Valid {
+		task.Deadline = &deadline.Time
+	}
 	if claimedBy.Valid {
 		task.ClaimedBy = claimedBy.String
 	}
@@ -184,7 +483,7 @@ func (s *Store) GetTask(id string) (*models.Task, error) {
 
 // ListTasks returns all tasks, optionally filtered by status.
 func (s *Store) ListTasks(status string) ([]models.Task, error) {
-	query := `SELECT id, title, description, status, claimed_by, claimed_at, created_at, updated_at FROM tasks`
+	query := `SELECT id, title, description, status, priority, deadline, claimed_by, claimed_at, created_at, updated_at FROM tasks`
 	var args []interface{}
 
 	if status != "" {
@@ -193,7 +492,7 @@ func (s *Store) ListTasks(status string) ([]models.Task, error) {
 	}
 	query += ` ORDER BY created_at DESC`
 
-	rows, err := s.db.Query(query, args...)
+	rows, err := s.rdb.Query(query, args...)
 	if err != nil {
 		return nil, fmt.Errorf("query tasks: %w", err)
 	}
@@ -202,11 +501,14 @@ func (s *Store) ListTasks(status string) ([]models.Task, error) {
 	var tasks []models.Task
 	for rows.Next() {
 		var task models.Task
-		var claimedAt sql.NullTime
+		var deadline, claimedAt sql.NullTime
 		var claimedBy sql.NullString
-		if err := rows.Scan(&task.ID, &task.Title, &task.Description, &task.Status, &claimedBy, &claimedAt, &task.CreatedAt, &task.UpdatedAt); err != nil {
+		if err := rows.Scan(&task.ID, &task.Title, &task.Description, &task.Status, &task.Priority, &deadline, &claimedBy, &claimedAt, &task.CreatedAt, &task.UpdatedAt); err != nil {
 			return nil, fmt.Errorf("scan task: %w", err)
 		}
+		if deadline.Valid {
+			task.Deadline = &deadline.Time
+		}
 		if claimedBy.Valid {
 			task.ClaimedBy = claimedBy.String
 		}
@@ -218,15 +520,185 @@ func (s *Store) ListTasks(status string) ([]models.Task, error) {
 	return tasks, rows.Err()
 }
 
+// TasksVersion returns a cheap validator over the tasks table: row count
+// plus the newest updated_at. Every insert, update, and delete changes it,
+// so it serves as an ETag for list responses.
+func (s *Store) TasksVersion() (string, error) {
+	var count int
+	var maxUpdated string
+	err := s.rdb.QueryRow(`SELECT COUNT(*), IFNULL(MAX(updated_at), '') FROM tasks`).Scan(&count, &maxUpdated)
+	if err != nil {
+		return "", fmt.Errorf("tasks version: %w", err)
+	}
+	return fmt.Sprintf("%d-%s", count, maxUpdated), nil
+}
+
+// ListTasksSince returns tasks whose updated_at is strictly after since,
+// oldest change first, optionally filtered by status. Deletions are not
+// reported; callers wanting full consistency re-fetch the whole list.
+func (s *Store) ListTasksSince(since time.Time, status string) ([]models.Task, error) {
+	query := `SELECT id, title, description, status, priority, deadline, claimed_by, claimed_at, created_at, updated_at FROM tasks WHERE updated_at > ?`
+	args := []interface{}{since.UTC()}
+
+	if status != "" {
+		query += ` AND status = ?`
+		args = append(args, status)
+	}
+	query += ` ORDER BY updated_at ASC`
+
+	rows, err := s.rdb.Query(query, args...)
+	if err != nil {
+		return nil, fmt.Errorf("query tasks since: %w", err)
+	}
+	defer rows.Close()
+
+	var tasks []models.Task
+	for rows.Next() {
+		var task models.Task
+		var deadline, claimedAt sql.NullTime
+		var claimedBy sql.NullString
+		if err := rows.Scan(&task.ID, &task.Title, &task.Description, &task.Status, &task.Priority, &deadline, &claimedBy, &claimedAt, &task.CreatedAt, &task.UpdatedAt); err != nil {
+			return nil, fmt.Errorf("scan task: %w", err)
+		}
+		if deadline.Valid {
+			task.Deadline = &deadline.Time
+		}
+		if claimedBy.Valid {
+			task.ClaimedBy = claimedBy.String
+		}
+		if claimedAt.Valid {
+			task.ClaimedAt = &claimedAt.Time
+		}
+		tasks = append(tasks, task)
+	}
+	return tasks, rows.Err()
+}
+
+// DefaultTaskPageSize is the page size used when a caller does not specify one.
+const DefaultTaskPageSize = 100
+
+// MaxTaskPageSize caps the page size a caller may request.
+const MaxTaskPageSize = 500
+
+// ListTasksPage returns one page of tasks ordered newest-first, using keyset
+// pagination on (created_at, id). status and claimedBy filter when non-empty.
+// cursor is the opaque value returned by a previous call ("" for the first
+// page); the returned cursor is "" when no further pages exist.
+func (s *Store) ListTasksPage(status, claimedBy string, limit int, cursor string) ([]models.Task, string, error) {
+	if limit <= 0 {
+		limit = DefaultTaskPageSize
+	}
+	if limit > MaxTaskPageSize {
+		limit = MaxTaskPageSize
+	}
+
+	query := `SELECT id, title, description, status, priority, deadline, claimed_by, claimed_at, created_at, updated_at FROM tasks WHERE 1=1`
+	var args []interface{}
+
+	if status != "" {
+		query += ` AND status = ?`
+		args = append(args, status)
+	}
+	if claimedBy != "" {
+		query += ` AND claimed_by = ?`
+		args = append(args, claimedBy)
+	}
+	if cursor != "" {
+		createdAt, id, err := decodeTaskCursor(cursor)
+		if err != nil {
+			return nil, "", fmt.Errorf("invalid cursor: %w", err)
+		}
+		query += ` AND (created_at < ? OR (created_at = ? AND id < ?))`
+		args = append(args, createdAt, createdAt, id)
+	}
+	query += ` ORDER BY created_at DESC, id DESC LIMIT ?`
+	args = append(args, limit)
+
+	rows, err := s.rdb.Query(query, args...)
+	if err != nil {
+		return nil, "", fmt.Errorf("query tasks: %w", err)
+	}
+	defer rows.Close()
+
+	var tasks []models.Task
+	for rows.Next() {
+		var task models.Task
+		var deadline, claimedAt sql.NullTime
+		var claimed sql.NullString
+		if err := rows.Scan(&task.ID, &task.Title, &task.Description, &task.Status, &task.Priority, &deadline, &claimed, &claimedAt, &task.CreatedAt, &task.UpdatedAt); err != nil {
+			return nil, "", fmt.Errorf("scan task: %w", err)
+		}
+		if deadline.Valid {
+			task.Deadline = &deadline.Time
+		}
+		if claimed.Valid {
+			task.ClaimedBy = claimed.String
+		}
+		if claimedAt.Valid {
+			task.ClaimedAt = &claimedAt.Time
+		}
+		tasks = append(tasks, task)
+	}
+	if err := rows.Err(); err != nil {
+		return nil, "", err
+	}
+
+	next := ""
+	if len(tasks) == limit {
+		last := tasks[len(tasks)-1]
+		next = encodeTaskCursor(last.CreatedAt, last.ID)
+	}
+	return tasks, next, nil
+}
+
+// encodeTaskCursor packs a keyset position into an opaque cursor string.
+func encodeTaskCursor(createdAt time.Time, id string) string {
+	return base64.RawURLEncoding.EncodeToString([]byte(createdAt.UTC().Format(time.RFC3339Nano) + "|" + id))
+}
+
+// decodeTaskCursor unpacks a cursor produced by encodeTaskCursor.
+func decodeTaskCursor(cursor string) (time.Time, string, error) {
+	raw, err := base64.RawURLEncoding.DecodeString(cursor)
+	if err != nil {
+		return time.Time{}, "", err
+	}
+	parts := strings.SplitN(string(raw), "|", 2)
+	if len(parts) != 2 {
+		return time.Time{}, "", fmt.Errorf("malformed cursor")
+	}
+	createdAt, err := time.Parse(time.RFC3339Nano, parts[0])
+	if err != nil {
+		return time.Time{}, "", err
+	}
+	return createdAt, parts[1], nil
+}
+
 // UpdateTaskStatus updates the status of a task.
 func (s *Store) UpdateTaskStatus(id string, status models.TaskStatus) error {
-	_, err := s.db.Exec(
-		`UPDATE tasks SET status = ?, updated_at = ? WHERE id = ?`,
-		status, time.Now().UTC(), id,
-	)
+	_, err := s.prep.updateTaskStatus.Exec(status, time.Now().UTC(), id)
 	return err
 }
 
+// EscalateDueTasks raises pending tasks whose deadline falls within window to
+// at least floor priority, so they win the claim ordering before the deadline
+// passes. One UPDATE covers all due tasks; returns how many were escalated.
+func (s *Store) EscalateDueTasks(window time.Duration, floor int) (int, error) {
+	now := time.Now().UTC()
+	res, err := s.db.Exec(
+		`UPDATE tasks SET priority = ?, updated_at = ?
+		 WHERE status = ? AND claimed_by IS NULL AND deadline IS NOT NULL AND deadline <= ? AND priority < ?`,
+		floor, now, models.TaskStatusPending, now.Add(window), floor,
+	)
+	if err != nil {
+		return 0, fmt.Errorf("escalate due tasks: %w", err)
+	}
+	escalated, err := res.RowsAffected()
+	if err != nil {
+		return 0, fmt.Errorf("check rows affected: %w", err)
+	}
+	return int(escalated), nil
+}
+
 // ClaimTask marks a task as claimed by a holder.
 func (s *Store) ClaimTask(id, holderID string) error {
 	now := time.Now().UTC()
@@ -253,6 +725,8 @@ var ErrTaskAlreadyLeased = fmt.Errorf("task already has an active lease")
 // It verifies the task exists and is claimable, then updates the task status and creates a lease.
 // On any error, neither the task status nor the lease is persisted.
 func (s *Store) ClaimTaskWithLeaseTx(taskID, holderID string, ttlSec int) (*ClaimResult, error) {
+	defer observeQuery("claim_task_with_lease")()
+
 	tx, err := s.db.Begin()
 	if err != nil {
 		return nil, fmt.Errorf("begin transaction: %w", err)
@@ -263,14 +737,11 @@ func (s *Store) ClaimTaskWithLeaseTx(taskID, holderID string, ttlSec int) (*Clai
 
 	// Step 1: Verify task exists and is claimable (pending status)
 	var task models.Task
-	var claimedAt sql.NullTime
+	var deadline, claimedAt sql.NullTime
 	var claimedBy sql.NullString
 
-	err = tx.QueryRow(
-		`SELECT id, title, description, status, claimed_by, claimed_at, created_at, updated_at
-		 FROM tasks WHERE id = ?`,
-		taskID,
-	).Scan(&task.ID, &task.Title, &task.Description, &task.Status, &claimedBy, &claimedAt, &task.CreatedAt, &task.UpdatedAt)
+	err = tx.Stmt(s.prep.getTask).QueryRow(taskID).
+		Scan(&task.ID, &task.Title, &task.Description, &task.Status, &task.Priority, &deadline, &claimedBy, &claimedAt, &task.CreatedAt, &task.UpdatedAt)
 
 	if err == sql.ErrNoRows {
 		return nil, ErrTaskNotClaimable
@@ -278,6 +749,9 @@ func (s *Store) ClaimTaskWithLeaseTx(taskID, holderID string, ttlSec int) (*Clai
 	if err != nil {
 		return nil, fmt.Errorf("query task: %w", err)
 	}
+	if deadline.Valid {
+		task.Deadline = &deadline.Time
+	}
 
 	// Check if task is in a claimable state (pending)
 	if task.Status != models.TaskStatusPending {
@@ -295,12 +769,12 @@ func (s *Store) ClaimTaskWithLeaseTx(taskID, holderID string, ttlSec int) (*Clai
 		return nil, fmt.Errorf("check existing lease: %w", err)
 	}
 	if existingLeaseID != "" {
+		leaseConflicts.Inc()
 		return nil, ErrTaskAlreadyLeased
 	}
 
 	// Step 3: Update task status to claimed
-	result, err := tx.Exec(
-		`UPDATE tasks SET status = ?, claimed_by = ?, claimed_at = ?, updated_at = ? WHERE id = ? AND status = ?`,
+	result, err := tx.Stmt(s.prep.claimTask).Exec(
 		models.TaskStatusClaimed, holderID, now, now, taskID, models.TaskStatusPending,
 	)
 	if err != nil {
@@ -326,8 +800,7 @@ func (s *Store) ClaimTaskWithLeaseTx(taskID, holderID string, ttlSec int) (*Clai
 		CreatedAt: now,
 	}
 
-	_, err = tx.Exec(
-		`INSERT INTO leases (id, task_id, holder_id, ttl_sec, expires_at, created_at) VALUES (?, ?, ?, ?, ?, ?)`,
+	_, err = tx.Stmt(s.prep.insertLease).Exec(
 		lease.ID, lease.TaskID, lease.HolderID, lease.TTLSec, lease.ExpiresAt, lease.CreatedAt,
 	)
 	if err != nil {
@@ -364,6 +837,8 @@ func (s *Store) ReleaseTask(id string) error {
 // AtomicClaimTask atomically claims a pending task and creates a lease.
 // Returns the task and lease if successful, or nil if the task is already claimed.
 func (s *Store) AtomicClaimTask(holderID string, ttlSec int) (*models.Task, *models.Lease, error) {
+	defer observeQuery("atomic_claim_task")()
+
 	now := time.Now().UTC()
 
 	// Start transaction for atomic claim
@@ -373,46 +848,27 @@ func (s *Store) AtomicClaimTask(holderID string, ttlSec int) (*models.Task, *mod
 	}
 	defer tx.Rollback()
 
-	// Find and lock a pending task
+	// Claim the best pending task in a single statement: the subquery probes
+	// idx_tasks_pending_priority and the UPDATE returns the claimed row, so
+	// there is no SELECT-then-UPDATE round trip to race against.
 	var taskID, title, description string
-	var createdAt, updatedAt time.Time
-	err = tx.QueryRow(
-		`SELECT id, title, description, created_at, updated_at FROM tasks 
-		 WHERE status = ? AND claimed_by IS NULL 
-		 ORDER BY created_at ASC LIMIT 1`,
-		models.TaskStatusPending,
-	).Scan(&taskID, &title, &description, &createdAt, &updatedAt)
+	var priority int
+	var createdAt time.Time
+	err = tx.Stmt(s.prep.claimOldest).QueryRow(
+		models.TaskStatusClaimed, holderID, now, now, models.TaskStatusPending,
+	).Scan(&taskID, &title, &description, &priority, &createdAt)
 
 	if err == sql.ErrNoRows {
 		return nil, nil, nil // No pending tasks
 	}
 	if err != nil {
-		return nil, nil, fmt.Errorf("query pending task: %w", err)
-	}
-
-	// Claim the task
-	res, err := tx.Exec(
-		`UPDATE tasks SET status = ?, claimed_by = ?, claimed_at = ?, updated_at = ? WHERE id = ? AND status = ?`,
-		models.TaskStatusClaimed, holderID, now, now, taskID, models.TaskStatusPending,
-	)
-	if err != nil {
-		return nil, nil, fmt.Errorf("claim task: %w", err)
-	}
-
-	// Verify the task was actually claimed (not already claimed by another worker)
-	rowsAffected, err := res.RowsAffected()
-	if err != nil {
-		return nil, nil, fmt.Errorf("check rows affected: %w", err)
-	}
-	if rowsAffected == 0 {
-		return nil, nil, nil // Task was already claimed by another worker, return nil to indicate no task available
+		return nil, nil, fmt.Errorf("claim pending task: %w", err)
 	}
 
 	// Create lease
 	leaseID := uuid.New().String()
 	expiresAt := now.Add(time.Duration(ttlSec) * time.Second)
-	_, err = tx.Exec(
-		`INSERT INTO leases (id, task_id, holder_id, ttl_sec, expires_at, created_at) VALUES (?, ?, ?, ?, ?, ?)`,
+	_, err = tx.Stmt(s.prep.insertLease).Exec(
 		leaseID, taskID, holderID, ttlSec, expiresAt, now,
 	)
 	if err != nil {
@@ -429,6 +885,7 @@ func (s *Store) AtomicClaimTask(holderID string, ttlSec int) (*models.Task, *mod
 		Title:       title,
 		Description: description,
 		Status:      models.TaskStatusClaimed,
+		Priority:    priority,
 		CreatedAt:   createdAt,
 		UpdatedAt:   now,
 		ClaimedBy:   holderID,
@@ -447,6 +904,71 @@ func (s *Store) AtomicClaimTask(holderID string, ttlSec int) (*models.Task, *mod
 	return task, lease, nil
 }
 
+// AtomicClaimTasks atomically claims up to n pending tasks in a single
+// transaction, creating a lease per task. Each claim gets a distinct holder ID
+// of the form holderPrefix + uuid. Returns the successful claims in claim
+// order (priority first, then age); fewer than n (possibly zero) when the
+// pending queue is shorter.
+func (s *Store) AtomicClaimTasks(holderPrefix string, n, ttlSec int) ([]ClaimResult, error) {
+	if n <= 0 {
+		return nil, nil
+	}
+	defer observeQuery("atomic_claim_tasks")()
+
+	now := time.Now().UTC()
+
+	tx, err := s.db.Begin()
+	if err != nil {
+		return nil, fmt.Errorf("begin transaction: %w", err)
+	}
+	defer tx.Rollback()
+
+	// Claim the best pending task one statement at a time; each claim is a
+	// single index probe against idx_tasks_pending_priority plus the row update.
+	claims := make([]ClaimResult, 0, n)
+	for i := 0; i < n; i++ {
+		holderID := holderPrefix + uuid.New().String()
+
+		var task models.Task
+		err := tx.Stmt(s.prep.claimOldest).QueryRow(
+			models.TaskStatusClaimed, holderID, now, now, models.TaskStatusPending,
+		).Scan(&task.ID, &task.Title, &task.Description, &task.Priority, &task.CreatedAt)
+		if err == sql.ErrNoRows {
+			break // Pending queue exhausted
+		}
+		if err != nil {
+			return nil, fmt.Errorf("claim pending task: %w", err)
+		}
+
+		lease := &models.Lease{
+			ID:        uuid.New().String(),
+			TaskID:    task.ID,
+			HolderID:  holderID,
+			TTLSec:    ttlSec,
+			ExpiresAt: now.Add(time.Duration(ttlSec) * time.Second),
+			CreatedAt: now,
+		}
+		_, err = tx.Stmt(s.prep.insertLease).Exec(
+			lease.ID, lease.TaskID, lease.HolderID, lease.TTLSec, lease.ExpiresAt, lease.CreatedAt,
+		)
+		if err != nil {
+			return nil, fmt.Errorf("create lease: %w", err)
+		}
+
+		task.Status = models.TaskStatusClaimed
+		task.ClaimedBy = holderID
+		task.ClaimedAt = &now
+		task.UpdatedAt = now
+		claims = append(claims, ClaimResult{Task: &task, Lease: lease})
+	}
+
+	if err := tx.Commit(); err != nil {
+		return nil, fmt.Errorf("commit transaction: %w", err)
+	}
+
+	return claims, nil
+}
+
 // --- Lease Operations ---
 
 // CreateLease creates a new lease for a task.
@@ -461,8 +983,7 @@ func (s *Store) CreateLease(taskID, holderID string, ttlSec int) (*models.Lease,
 		CreatedAt: now,
 	}
 
-	_, err := s.db.Exec(
-		`INSERT INTO leases (id, task_id, holder_id, ttl_sec, expires_at, created_at) VALUES (?, ?, ?, ?, ?, ?)`,
+	_, err := s.prep.insertLease.Exec(
 		lease.ID, lease.TaskID, lease.HolderID, lease.TTLSec, lease.ExpiresAt, lease.CreatedAt,
 	)
 	if err != nil {
@@ -474,7 +995,7 @@ func (s *Store) CreateLease(taskID, holderID string, ttlSec int) (*models.Lease,
 // GetActiveLease returns the active lease for a task, if any.
 func (s *Store) GetActiveLease(taskID string) (*models.Lease, error) {
 	lease := &models.Lease{}
-	err := s.db.QueryRow(
+	err := s.rdb.QueryRow(
 		`SELECT id, task_id, holder_id, ttl_sec, expires_at, created_at FROM leases WHERE task_id = ? AND expires_at > ? ORDER BY created_at DESC LIMIT 1`,
 		taskID, time.Now().UTC(),
 	).Scan(&lease.ID, &lease.TaskID, &lease.HolderID, &lease.TTLSec, &lease.ExpiresAt, &lease.CreatedAt)
@@ -490,120 +1011,89 @@ func (s *Store) GetActiveLease(taskID string) (*models.Lease, error) {
 
 // RenewLease extends the expiry of a lease (heartbeat).
 func (s *Store) RenewLease(leaseID string, ttlSec int) error {
-	_, err := s.db.Exec(
-		`UPDATE leases SET expires_at = ? WHERE id = ?`,
+	_, err := s.prep.renewLease.Exec(
 		time.Now().UTC().Add(time.Duration(ttlSec)*time.Second), leaseID,
 	)
 	return err
 }
 
-// DeleteLease removes a lease.
-func (s *Store) DeleteLease(leaseID string) error {
-	_, err := s.db.Exec(`DELETE FROM leases WHERE id = ?`, leaseID)
-	return err
-}
-
-// --- Lock Operations ---
+// RenewLeases extends the expiry of multiple leases in one batched UPDATE
+// (heartbeat): one write transaction for N leases instead of N.
+func (s *Store) RenewLeases(leaseIDs []string, ttlSec int) error {
+	if len(leaseIDs) == 0 {
+		return nil
+	}
 
-// ErrResourceLocked indicates the resource is already locked by another holder.
-var ErrResourceLocked = fmt.Errorf("resource already locked")
+	expiresAt := time.Now().UTC().Add(time.Duration(ttlSec) * time.Second)
+	args := make([]interface{}, 0, len(leaseIDs)+1)
+	args = append(args, expiresAt)
+	placeholders := make([]string, len(leaseIDs))
+	for i, id := range leaseIDs {
+		placeholders[i] = "?"
+		args = append(args, id)
+	}
 
-// LockConflict contains information about an existing lock when acquisition fails.
-type LockConflict struct {
-	HolderID  string
-	ExpiresAt time.Time
+	_, err := s.db.Exec(
+		`UPDATE leases SET expires_at = ? WHERE id IN (`+strings.Join(placeholders, ", ")+`)`,
+		args...,
+	)
+	return err
 }
 
-// AcquireLock attempts to acquire a lock on a resource atomically.
-// It first cleans up expired locks, then attempts to insert a new lock.
-// If a lock already exists, it returns ErrResourceLocked.
-func (s *Store) AcquireLock(resourceID, holderID, lockType string, ttlSec int) (*models.Lock, error) {
-	// Use IMMEDIATE transaction to acquire write lock early and prevent races
-	tx, err := s.db.BeginTx(context.Background(), &sql.TxOptions{Isolation: sql.LevelDefault})
-	if err != nil {
-		return nil, fmt.Errorf("begin transaction: %w", err)
-	}
-	defer tx.Rollback()
-
+// RecoverExpiredTasks returns claimed tasks whose lease has expired (or was
+// never created) to pending and deletes expired leases, so orphaned work
+// becomes claimable again. Returns the number of recovered tasks.
+func (s *Store) RecoverExpiredTasks() (int, error) {
 	now := time.Now().UTC()
 
-	// Step 1: Clean up expired locks for this resource within the transaction
-	_, err = tx.Exec(`DELETE FROM locks WHERE resource_id = ? AND expires_at <= ?`, resourceID, now)
+	tx, err := s.db.Begin()
 	if err != nil {
-		return nil, fmt.Errorf("clean expired locks: %w", err)
+		return 0, fmt.Errorf("begin transaction: %w", err)
 	}
+	defer tx.Rollback()
 
-	// Step 2: Check for existing non-expired lock
-	var existingHolder string
-	var existingExpires time.Time
-	err = tx.QueryRow(
-		`SELECT holder_id, expires_at FROM locks WHERE resource_id = ? AND expires_at > ?`,
-		resourceID, now,
-	).Scan(&existingHolder, &existingExpires)
-
-	if err != nil && err != sql.ErrNoRows {
-		return nil, fmt.Errorf("check existing lock: %w", err)
+	res, err := tx.Exec(
+		`UPDATE tasks SET status = ?, claimed_by = NULL, claimed_at = NULL, updated_at = ?
+		 WHERE status = ? AND id NOT IN (SELECT task_id FROM leases WHERE expires_at > ?)`,
+		models.TaskStatusPending, now, models.TaskStatusClaimed, now,
+	)
+	if err != nil {
+		return 0, fmt.Errorf("recover tasks: %w", err)
 	}
-	if err != sql.ErrNoRows {
-		// Lock exists and is not expired
-		return nil, ErrResourceLocked
+	recovered, err := res.RowsAffected()
+	if err != nil {
+		return 0, fmt.Errorf("check rows affected: %w", err)
 	}
 
-	// Step 3: Insert new lock
-	lock := &models.Lock{
-		ID:         uuid.New().String(),
-		ResourceID: resourceID,
-		HolderID:   holderID,
-		LockType:   lockType,
-		CreatedAt:  now,
-		ExpiresAt:  now.Add(time.Duration(ttlSec) * time.Second),
+	if _, err := tx.Exec(`DELETE FROM leases WHERE expires_at <= ?`, now); err != nil {
+		return 0, fmt.Errorf("delete expired leases: %w", err)
 	}
 
-	_, err = tx.Exec(
-		`INSERT INTO locks (id, resource_id, holder_id, lock_type, created_at, expires_at) VALUES (?, ?, ?, ?, ?, ?)`,
-		lock.ID, lock.ResourceID, lock.HolderID, lock.LockType, lock.CreatedAt, lock.ExpiresAt,
-	)
-	if err != nil {
-		// Check if this is a UNIQUE constraint violation (race condition)
-		if strings.Contains(err.Error(), "UNIQUE constraint") || strings.Contains(err.Error(), "unique constraint") {
-			return nil, ErrResourceLocked
-		}
-		return nil, fmt.Errorf("insert lock: %w", err)
-	}
-
-	// Step 4: Commit transaction
 	if err := tx.Commit(); err != nil {
-		return nil, fmt.Errorf("commit transaction: %w", err)
+		return 0, fmt.Errorf("commit transaction: %w", err)
 	}
+	return int(recovered), nil
+}
 
-	return lock, nil
+// DeleteLease removes a lease.
+func (s *Store) DeleteLease(leaseID string) error {
+	_, err := s.db.Exec(`DELETE FROM leases WHERE id = ?`, leaseID)
+	return err
 }
 
-// GetLock retrieves a lock by resource ID if it exists and is not expired.
-func (s *Store) GetLock(resourceID string) (*models.Lock, error) {
-	now := time.Now().UTC()
-	lock := &models.Lock{}
+// --- Lock Operations ---
 
-	err := s.db.QueryRow(
-		`SELECT id, resource_id, holder_id, lock_type, created_at, expires_at
-		 FROM locks WHERE resource_id = ? AND expires_at > ?`,
-		resourceID, now,
-	).Scan(&lock.ID, &lock.ResourceID, &lock.HolderID, &lock.LockType, &lock.CreatedAt, &lock.ExpiresAt)
+// ErrResourceLocked indicates the resource is already locked by another holder.
+var ErrResourceLocked = fmt.Errorf("resource already locked")
 
-	if err == sql.ErrNoRows {
-		return nil, nil
-	}
-	if err != nil {
-		return nil, fmt.Errorf("query lock: %w", err)
-	}
-	return lock, nil
+// LockConflict contains information about an existing lock when acquisition fails.
+type LockConflict struct {
+	HolderID  string
+	ExpiresAt time.Time
 }
 
-// ReleaseLock releases a lock.
-func (s *Store) ReleaseLock(lockID string) error {
-	_, err := s.db.Exec(`DELETE FROM locks WHERE id = ?`, lockID)
-	return err
-}
+// AcquireLock, GetLock, and ReleaseLock live in locks.go: the lock table
+// is held in memory and persisted with write-behind flushes.
 
 // --- Run Operations ---
 
@@ -633,16 +1123,236 @@ func (s *Store) CreateRun(taskID, command string, args []string) (*models.Run, e
 // UpdateRun updates a run with results.
 func (s *Store) UpdateRun(id string, exitCode int, stdout, stderr string) error {
 	_, err := s.db.Exec(
-		`UPDATE runs SET exit_code = ?, stdout = ?, stderr = ?, ended_at = ? WHERE id = ?`,
-		exitCode, stdout, stderr, time.Now().UTC(), id,
+		`UPDATE runs SET exit_code = ?, ended_at = ? WHERE id = ?`,
+		exitCode, time.Now().UTC(), id,
+	)
+	if err != nil {
+		return err
+	}
+
+	// Output goes to compressed chunks, not the legacy TEXT columns
+	if stdout != "" {
+		if err := s.AppendRunLog(id, "stdout", []byte(stdout)); err != nil {
+			return err
+		}
+	}
+	if stderr != "" {
+		if err := s.AppendRunLog(id, "stderr", []byte(stderr)); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// FinishRun records a run's exit code and end time. Output is not touched:
+// streaming callers have already persisted it chunk by chunk via AppendRunLog.
+func (s *Store) FinishRun(id string, exitCode int) error {
+	_, err := s.db.Exec(
+		`UPDATE runs SET exit_code = ?, ended_at = ? WHERE id = ?`,
+		exitCode, time.Now().UTC(), id,
 	)
 	return err
 }
 
-// GetRunsForTask returns all runs for a task.
+// GetRun returns a run's metadata (no output) or nil when not found.
+func (s *Store) GetRun(id string) (*models.Run, error) {
+	var run models.Run
+	var argsJSON string
+	var endedAt sql.NullTime
+	var exitCode sql.NullInt64
+
+	err := s.rdb.QueryRow(
+		`SELECT id, task_id, command, args, exit_code, started_at, ended_at FROM runs WHERE id = ?`,
+		id,
+	).Scan(&run.ID, &run.TaskID, &run.Command, &argsJSON, &exitCode, &run.StartedAt, &endedAt)
+
+	if err == sql.ErrNoRows {
+		return nil, nil
+	}
+	if err != nil {
+		return nil, fmt.Errorf("query run: %w", err)
+	}
+	if argsJSON != "" {
+		json.Unmarshal([]byte(argsJSON), &run.Args)
+	}
+	if exitCode.Valid {
+		run.ExitCode = int(exitCode.Int64)
+	}
+	if endedAt.Valid {
+		run.EndedAt = endedAt.Time
+	}
+	return &run, nil
+}
+
+// runLogChunkSize caps the uncompressed size of a single run-log chunk.
+const runLogChunkSize = 256 * 1024
+
+// AppendRunLog appends output to a run's log as compressed, size-capped
+// chunks. Safe to call repeatedly while a command is still executing; chunks
+// are sequenced per (run, stream).
+func (s *Store) AppendRunLog(runID, stream string, data []byte) error {
+	if len(data) == 0 {
+		return nil
+	}
+	defer observeQuery("append_run_log")()
+
+	tx, err := s.db.Begin()
+	if err != nil {
+		return fmt.Errorf("begin transaction: %w", err)
+	}
+	defer tx.Rollback()
+
+	var seq int
+	err = tx.QueryRow(
+		`SELECT COALESCE(MAX(seq), -1) + 1 FROM run_log_chunks WHERE run_id = ? AND stream = ?`,
+		runID, stream,
+	).Scan(&seq)
+	if err != nil {
+		return fmt.Errorf("next chunk seq: %w", err)
+	}
+
+	for off := 0; off < len(data); off += runLogChunkSize {
+		end := off + runLogChunkSize
+		if end > len(data) {
+			end = len(data)
+		}
+		chunk := data[off:end]
+
+		var buf bytes.Buffer
+		zw := gzip.NewWriter(&buf)
+		if _, err := zw.Write(chunk); err != nil {
+			return fmt.Errorf("compress chunk: %w", err)
+		}
+		if err := zw.Close(); err != nil {
+			return fmt.Errorf("compress chunk: %w", err)
+		}
+
+		_, err = tx.Exec(
+			`INSERT INTO run_log_chunks (run_id, stream, seq, data, raw_len) VALUES (?, ?, ?, ?, ?)`,
+			runID, stream, seq, buf.Bytes(), len(chunk),
+		)
+		if err != nil {
+			return fmt.Errorf("insert chunk: %w", err)
+		}
+		seq++
+	}
+
+	return tx.Commit()
+}
+
+// GetRunLog reassembles one stream ("stdout" or "stderr") of a run's log
+// from its compressed chunks. Falls back to the legacy inline TEXT column for
+// runs recorded before chunked storage.
+func (s *Store) GetRunLog(runID, stream string) (string, error) {
+	rows, err := s.rdb.Query(
+		`SELECT data, raw_len FROM run_log_chunks WHERE run_id = ? AND stream = ? ORDER BY seq ASC`,
+		runID, stream,
+	)
+	if err != nil {
+		return "", fmt.Errorf("query chunks: %w", err)
+	}
+	defer rows.Close()
+
+	var out bytes.Buffer
+	found := false
+	for rows.Next() {
+		var data []byte
+		var rawLen int
+		if err := rows.Scan(&data, &rawLen); err != nil {
+			return "", fmt.Errorf("scan chunk: %w", err)
+		}
+		found = true
+
+		zr, err := gzip.NewReader(bytes.NewReader(data))
+		if err != nil {
+			return "", fmt.Errorf("decompress chunk: %w", err)
+		}
+		if _, err := io.Copy(&out, zr); err != nil {
+			zr.Close()
+			return "", fmt.Errorf("decompress chunk: %w", err)
+		}
+		zr.Close()
+	}
+	if err := rows.Err(); err != nil {
+		return "", err
+	}
+	if found {
+		return out.String(), nil
+	}
+
+	// Legacy rows keep output inline in the runs table
+	if stream != "stdout" && stream != "stderr" {
+		return "", fmt.Errorf("unknown stream %q", stream)
+	}
+	var legacy sql.NullString
+	err = s.rdb.QueryRow(`SELECT `+stream+` FROM runs WHERE id = ?`, runID).Scan(&legacy)
+	if err == sql.ErrNoRows {
+		return "", nil
+	}
+	if err != nil {
+		return "", fmt.Errorf("query legacy log: %w", err)
+	}
+	return legacy.String, nil
+}
+
+// GetRunLogSince returns the decompressed data of one stream's chunks with
+// seq > afterSeq, plus the highest seq seen. Tailing callers poll with the
+// returned seq to read only what is new.
+func (s *Store) GetRunLogSince(runID, stream string, afterSeq int) ([]byte, int, error) {
+	rows, err := s.rdb.Query(
+		`SELECT seq, data FROM run_log_chunks WHERE run_id = ? AND stream = ? AND seq > ? ORDER BY seq ASC`,
+		runID, stream, afterSeq,
+	)
+	if err != nil {
+		return nil, afterSeq, fmt.Errorf("query chunks: %w", err)
+	}
+	defer rows.Close()
+
+	var out bytes.Buffer
+	lastSeq := afterSeq
+	for rows.Next() {
+		var seq int
+		var data []byte
+		if err := rows.Scan(&seq, &data); err != nil {
+			return nil, afterSeq, fmt.Errorf("scan chunk: %w", err)
+		}
+
+		zr, err := gzip.NewReader(bytes.NewReader(data))
+		if err != nil {
+			return nil, afterSeq, fmt.Errorf("decompress chunk: %w", err)
+		}
+		if _, err := io.Copy(&out, zr); err != nil {
+			zr.Close()
+			return nil, afterSeq, fmt.Errorf("decompress chunk: %w", err)
+		}
+		zr.Close()
+		lastSeq = seq
+	}
+	if err := rows.Err(); err != nil {
+		return nil, afterSeq, err
+	}
+	return out.Bytes(), lastSeq, nil
+}
+
+// GetRunOutput returns both streams of a run's log.
+func (s *Store) GetRunOutput(runID string) (stdout, stderr string, err error) {
+	stdout, err = s.GetRunLog(runID, "stdout")
+	if err != nil {
+		return "", "", err
+	}
+	stderr, err = s.GetRunLog(runID, "stderr")
+	if err != nil {
+		return "", "", err
+	}
+	return stdout, stderr, nil
+}
+
+// GetRunsForTask returns all runs for a task, metadata only: output is not
+// loaded here, so memory cost is independent of log volume. Fetch a specific
+// run's output lazily via GetRunLog/GetRunOutput.
 func (s *Store) GetRunsForTask(taskID string) ([]models.Run, error) {
-	rows, err := s.db.Query(
-		`SELECT id, task_id, command, args, exit_code, stdout, stderr, started_at, ended_at FROM runs WHERE task_id = ? ORDER BY started_at DESC`,
+	rows, err := s.rdb.Query(
+		`SELECT id, task_id, command, args, exit_code, started_at, ended_at FROM runs WHERE task_id = ? ORDER BY started_at DESC`,
 		taskID,
 	)
 	if err != nil {
@@ -656,9 +1366,8 @@ func (s *Store) GetRunsForTask(taskID string) ([]models.Run, error) {
 		var argsJSON string
 		var endedAt sql.NullTime
 		var exitCode sql.NullInt64
-		var stdout, stderr sql.NullString
 
-		if err := rows.Scan(&run.ID, &run.TaskID, &run.Command, &argsJSON, &exitCode, &stdout, &stderr, &run.StartedAt, &endedAt); err != nil {
+		if err := rows.Scan(&run.ID, &run.TaskID, &run.Command, &argsJSON, &exitCode, &run.StartedAt, &endedAt); err != nil {
 			return nil, fmt.Errorf("scan run: %w", err)
 		}
 
@@ -668,12 +1377,6 @@ func (s *Store) GetRunsForTask(taskID string) ([]models.Run, error) {
 		if exitCode.Valid {
 			run.ExitCode = int(exitCode.Int64)
 		}
-		if stdout.Valid {
-			run.Stdout = stdout.String
-		}
-		if stderr.Valid {
-			run.Stderr = stderr.String
-		}
 		if endedAt.Valid {
 			run.EndedAt = endedAt.Time
 		}
@@ -683,29 +1386,8 @@ func (s *Store) GetRunsForTask(taskID string) ([]models.Run, error) {
 }
 
 // --- PDR Operations ---
-
-// WritePDR writes a Process Decision Record.
-func (s *Store) WritePDR(action, inputsHash, outcome, taskID, details string) (*models.PDREntry, error) {
-	now := time.Now().UTC()
-	pdr := &models.PDREntry{
-		ID:         uuid.New().String(),
-		Action:     action,
-		InputsHash: inputsHash,
-		Outcome:    outcome,
-		TaskID:     taskID,
-		Details:    details,
-		Timestamp:  now,
-	}
-
-	_, err := s.db.Exec(
-		`INSERT INTO pdr (id, action, inputs_hash, outcome, task_id, details, timestamp) VALUES (?, ?, ?, ?, ?, ?, ?)`,
-		pdr.ID, pdr.Action, pdr.InputsHash, pdr.Outcome, pdr.TaskID, pdr.Details, pdr.Timestamp,
-	)
-	if err != nil {
-		return nil, fmt.Errorf("insert pdr: %w", err)
-	}
-	return pdr, nil
-}
+// WritePDR, WritePDRBatch, QueryPDR, and the retention/rollup subsystem
+// live in pdr.go.
 
 // --- Memory Operations ---
 
@@ -720,22 +1402,63 @@ func (s *Store) AddMemory(taskID, content, tags string) (*models.MemoryItem, err
 		CreatedAt: now,
 	}
 
-	_, err := s.db.Exec(
+	tx, err := s.db.Begin()
+	if err != nil {
+		return nil, fmt.Errorf("begin transaction: %w", err)
+	}
+	defer tx.Rollback()
+
+	res, err := tx.Exec(
 		`INSERT INTO memory_items (id, task_id, content, tags, created_at) VALUES (?, ?, ?, ?, ?)`,
 		item.ID, item.TaskID, item.Content, item.Tags, item.CreatedAt,
 	)
 	if err != nil {
 		return nil, fmt.Errorf("insert memory: %w", err)
 	}
+
+	// Keep the external-content FTS index in sync with the new row
+	rowid, err := res.LastInsertId()
+	if err != nil {
+		return nil, fmt.Errorf("memory rowid: %w", err)
+	}
+	if _, err := tx.Exec(`INSERT INTO memory_fts(rowid, content) VALUES (?, ?)`, rowid, item.Content); err != nil {
+		return nil, fmt.Errorf("index memory: %w", err)
+	}
+
+	if err := tx.Commit(); err != nil {
+		return nil, fmt.Errorf("commit transaction: %w", err)
+	}
 	return item, nil
 }
 
-// QueryMemory searches memory items by content.
-func (s *Store) QueryMemory(query string) ([]models.MemoryItem, error) {
-	rows, err := s.db.Query(
-		`SELECT id, task_id, content, tags, created_at FROM memory_items WHERE content LIKE ? ORDER BY created_at DESC LIMIT 50`,
-		"%"+strings.TrimSpace(query)+"%",
+// QueryMemory searches memory items by content using the FTS index, ranked by
+// relevance. An empty query returns the most recent items. A non-empty tag
+// restricts results to items carrying that tag.
+func (s *Store) QueryMemory(query, tag string) ([]models.MemoryItem, error) {
+	var (
+		q    string
+		args []interface{}
 	)
+
+	tagFilter := ``
+	if tag != "" {
+		tagFilter = ` AND instr(',' || IFNULL(m.tags, '') || ',', ?) > 0`
+	}
+
+	if match := ftsQuery(query); match != "" {
+		q = `SELECT m.id, m.task_id, m.content, m.tags, m.created_at
+		 FROM memory_fts f JOIN memory_items m ON m.rowid = f.rowid
+		 WHERE memory_fts MATCH ?` + tagFilter + ` ORDER BY rank LIMIT 50`
+		args = append(args, match)
+	} else {
+		q = `SELECT m.id, m.task_id, m.content, m.tags, m.created_at
+		 FROM memory_items m WHERE 1=1` + tagFilter + ` ORDER BY m.created_at DESC LIMIT 50`
+	}
+	if tag != "" {
+		args = append(args, ","+tag+",")
+	}
+
+	rows, err := s.rdb.Query(q, args...)
 	if err != nil {
 		return nil, fmt.Errorf("query memory: %w", err)
 	}
@@ -756,9 +1479,24 @@ func (s *Store) QueryMemory(query string) ([]models.MemoryItem, error) {
 	return items, rows.Err()
 }
 
+// ftsQuery converts free-form user input into a safe FTS5 match expression by
+// quoting each term, so operator characters in the input cannot break the
+// query syntax. Returns "" for empty input.
+func ftsQuery(query string) string {
+	terms := strings.Fields(strings.TrimSpace(query))
+	if len(terms) == 0 {
+		return ""
+	}
+	quoted := make([]string, len(terms))
+	for i, term := range terms {
+		quoted[i] = `"` + strings.ReplaceAll(term, `"`, `""`) + `"`
+	}
+	return strings.Join(quoted, " ")
+}
+
 // GetMemoryForTask returns memory items for a specific task.
 func (s *Store) GetMemoryForTask(taskID string) ([]models.MemoryItem, error) {
-	rows, err := s.db.Query(
+	rows, err := s.rdb.Query(
 		`SELECT id, task_id, content, tags, created_at FROM memory_items WHERE task_id = ? ORDER BY created_at DESC`,
 		taskID,
 	)
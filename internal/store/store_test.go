@@ -5,6 +5,7 @@ import (
 	"fmt"
 	"os"
 	"path/filepath"
+	"strings"
 	"testing"
 	"time"
 
@@ -90,6 +91,269 @@ func TestTaskCRUD(t *testing.T) {
 	}
 }
 
+func TestCreateTasks_Bulk(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	deadline := time.Now().UTC().Add(time.Hour)
+	specs := make([]TaskSpec, 50)
+	for i := range specs {
+		specs[i] = TaskSpec{Title: fmt.Sprintf("Bulk %d", i), Priority: i % 3}
+	}
+	specs[0].Deadline = &deadline
+
+	tasks, err := s.CreateTasks(specs)
+	if err != nil {
+		t.Fatalf("CreateTasks failed: %v", err)
+	}
+	if len(tasks) != len(specs) {
+		t.Fatalf("Expected %d tasks, got %d", len(specs), len(tasks))
+	}
+
+	// Input order and fields are preserved
+	for i, task := range tasks {
+		if task.Title != specs[i].Title {
+			t.Errorf("Task %d title = %q, want %q", i, task.Title, specs[i].Title)
+		}
+		if task.Priority != specs[i].Priority {
+			t.Errorf("Task %d priority = %d, want %d", i, task.Priority, specs[i].Priority)
+		}
+		if task.Status != models.TaskStatusPending {
+			t.Errorf("Task %d status = %s, want pending", i, task.Status)
+		}
+	}
+
+	// All rows landed and are claimable
+	got, err := s.GetTask(tasks[0].ID)
+	if err != nil {
+		t.Fatalf("GetTask failed: %v", err)
+	}
+	if got.Deadline == nil {
+		t.Error("Expected deadline to be persisted")
+	}
+	all, err := s.ListTasks("pending")
+	if err != nil {
+		t.Fatalf("ListTasks failed: %v", err)
+	}
+	if len(all) != len(specs) {
+		t.Errorf("Expected %d pending tasks, got %d", len(specs), len(all))
+	}
+
+	// Empty batch is a no-op
+	none, err := s.CreateTasks(nil)
+	if err != nil {
+		t.Fatalf("CreateTasks(nil) failed: %v", err)
+	}
+	if none != nil {
+		t.Errorf("Expected nil result for empty batch, got %d tasks", len(none))
+	}
+}
+
+func TestPriorityClaimOrder(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	low, err := s.CreateTask("Batch refactor", "")
+	if err != nil {
+		t.Fatalf("CreateTask failed: %v", err)
+	}
+	urgent, err := s.CreateTaskWithPriority("Production fix", "", 10, nil)
+	if err != nil {
+		t.Fatalf("CreateTaskWithPriority failed: %v", err)
+	}
+
+	// The urgent task was created later but must be claimed first
+	task, lease, err := s.AtomicClaimTask("worker", 60)
+	if err != nil {
+		t.Fatalf("AtomicClaimTask failed: %v", err)
+	}
+	if task.ID != urgent.ID {
+		t.Errorf("Expected urgent task %s claimed first, got %s", urgent.ID, task.ID)
+	}
+	if task.Priority != 10 {
+		t.Errorf("Expected priority 10 on claimed task, got %d", task.Priority)
+	}
+	s.DeleteLease(lease.ID)
+
+	task, lease, err = s.AtomicClaimTask("worker", 60)
+	if err != nil {
+		t.Fatalf("AtomicClaimTask failed: %v", err)
+	}
+	if task.ID != low.ID {
+		t.Errorf("Expected low-priority task %s claimed second, got %s", low.ID, task.ID)
+	}
+	s.DeleteLease(lease.ID)
+}
+
+func TestEscalateDueTasks(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	soon := time.Now().UTC().Add(1 * time.Minute)
+	far := time.Now().UTC().Add(24 * time.Hour)
+
+	due, err := s.CreateTaskWithPriority("Due soon", "", 0, &soon)
+	if err != nil {
+		t.Fatalf("CreateTaskWithPriority failed: %v", err)
+	}
+	relaxed, err := s.CreateTaskWithPriority("Due tomorrow", "", 0, &far)
+	if err != nil {
+		t.Fatalf("CreateTaskWithPriority failed: %v", err)
+	}
+
+	escalated, err := s.EscalateDueTasks(5*time.Minute, 100)
+	if err != nil {
+		t.Fatalf("EscalateDueTasks failed: %v", err)
+	}
+	if escalated != 1 {
+		t.Errorf("Expected 1 escalated task, got %d", escalated)
+	}
+
+	got, _ := s.GetTask(due.ID)
+	if got.Priority != 100 {
+		t.Errorf("Expected due task escalated to priority 100, got %d", got.Priority)
+	}
+	got, _ = s.GetTask(relaxed.ID)
+	if got.Priority != 0 {
+		t.Errorf("Expected far-deadline task untouched, got priority %d", got.Priority)
+	}
+
+	// A second sweep must not touch the already-escalated task
+	escalated, err = s.EscalateDueTasks(5*time.Minute, 100)
+	if err != nil {
+		t.Fatalf("EscalateDueTasks failed: %v", err)
+	}
+	if escalated != 0 {
+		t.Errorf("Expected idempotent sweep, got %d escalations", escalated)
+	}
+}
+
+func TestListTasksPage(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	for i := 0; i < 7; i++ {
+		if _, err := s.CreateTask(fmt.Sprintf("Task %d", i), ""); err != nil {
+			t.Fatalf("CreateTask failed: %v", err)
+		}
+	}
+
+	// Walk all pages with a page size of 3
+	seen := make(map[string]bool)
+	cursor := ""
+	pages := 0
+	for {
+		tasks, next, err := s.ListTasksPage("", "", 3, cursor)
+		if err != nil {
+			t.Fatalf("ListTasksPage failed: %v", err)
+		}
+		if len(tasks) > 3 {
+			t.Errorf("Page exceeded limit: %d tasks", len(tasks))
+		}
+		for _, task := range tasks {
+			if seen[task.ID] {
+				t.Errorf("Task %s appeared on multiple pages", task.ID)
+			}
+			seen[task.ID] = true
+		}
+		pages++
+		if next == "" {
+			break
+		}
+		cursor = next
+		if pages > 10 {
+			t.Fatal("Pagination did not terminate")
+		}
+	}
+	if len(seen) != 7 {
+		t.Errorf("Expected 7 tasks across pages, got %d", len(seen))
+	}
+
+	// Status filter pushdown
+	tasks, _, err := s.ListTasksPage("completed", "", 0, "")
+	if err != nil {
+		t.Fatalf("ListTasksPage with status failed: %v", err)
+	}
+	if len(tasks) != 0 {
+		t.Errorf("Expected 0 completed tasks, got %d", len(tasks))
+	}
+
+	// claimed_by filter pushdown
+	all, _, _ := s.ListTasksPage("", "", 0, "")
+	if err := s.ClaimTask(all[0].ID, "holder-1"); err != nil {
+		t.Fatalf("ClaimTask failed: %v", err)
+	}
+	tasks, _, err = s.ListTasksPage("", "holder-1", 0, "")
+	if err != nil {
+		t.Fatalf("ListTasksPage with claimed_by failed: %v", err)
+	}
+	if len(tasks) != 1 {
+		t.Errorf("Expected 1 task claimed by holder-1, got %d", len(tasks))
+	}
+
+	// Garbage cursor is rejected
+	if _, _, err := s.ListTasksPage("", "", 0, "not-a-cursor"); err == nil {
+		t.Error("Expected error for malformed cursor")
+	}
+}
+
+func TestTasksVersionAndListSince(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	v0, err := s.TasksVersion()
+	if err != nil {
+		t.Fatalf("TasksVersion failed: %v", err)
+	}
+
+	task, err := s.CreateTask("Task", "Description")
+	if err != nil {
+		t.Fatalf("CreateTask failed: %v", err)
+	}
+
+	v1, err := s.TasksVersion()
+	if err != nil {
+		t.Fatalf("TasksVersion failed: %v", err)
+	}
+	if v1 == v0 {
+		t.Error("Version should change after an insert")
+	}
+
+	// Unchanged table keeps the same validator
+	v2, _ := s.TasksVersion()
+	if v2 != v1 {
+		t.Errorf("Version changed without a write: %s vs %s", v1, v2)
+	}
+
+	// Delta fetch: everything changed since before the insert
+	since := task.CreatedAt.Add(-time.Second)
+	changed, err := s.ListTasksSince(since, "")
+	if err != nil {
+		t.Fatalf("ListTasksSince failed: %v", err)
+	}
+	if len(changed) != 1 || changed[0].ID != task.ID {
+		t.Errorf("Expected the new task in the delta, got %d rows", len(changed))
+	}
+
+	// Nothing changed since after the insert
+	changed, err = s.ListTasksSince(task.UpdatedAt.Add(time.Second), "")
+	if err != nil {
+		t.Fatalf("ListTasksSince failed: %v", err)
+	}
+	if len(changed) != 0 {
+		t.Errorf("Expected empty delta, got %d rows", len(changed))
+	}
+
+	// A claim updates the row and the validator
+	if err := s.ClaimTask(task.ID, "holder-1"); err != nil {
+		t.Fatalf("ClaimTask failed: %v", err)
+	}
+	v3, _ := s.TasksVersion()
+	if v3 == v1 {
+		t.Error("Version should change after an update")
+	}
+}
+
 func TestClaimAndRelease(t *testing.T) {
 	s := newTestStore(t)
 	defer s.Close()
@@ -164,6 +428,82 @@ func TestLeases(t *testing.T) {
 	}
 }
 
+func TestRenewLeasesBatch(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	var leaseIDs []string
+	for i := 0; i < 3; i++ {
+		task, _ := s.CreateTask("Test", "")
+		lease, err := s.CreateLease(task.ID, "holder", 1)
+		if err != nil {
+			t.Fatalf("CreateLease failed: %v", err)
+		}
+		leaseIDs = append(leaseIDs, lease.ID)
+	}
+
+	if err := s.RenewLeases(leaseIDs, 300); err != nil {
+		t.Fatalf("RenewLeases failed: %v", err)
+	}
+
+	// All leases should now expire well in the future
+	for i, id := range leaseIDs {
+		var expiresAt time.Time
+		err := s.rdb.QueryRow(`SELECT expires_at FROM leases WHERE id = ?`, id).Scan(&expiresAt)
+		if err != nil {
+			t.Fatalf("query lease %d: %v", i, err)
+		}
+		if time.Until(expiresAt) < 200*time.Second {
+			t.Errorf("Lease %d not renewed: expires %v", i, expiresAt)
+		}
+	}
+
+	// Empty batch is a no-op
+	if err := s.RenewLeases(nil, 300); err != nil {
+		t.Errorf("RenewLeases(nil) should be a no-op, got %v", err)
+	}
+}
+
+func TestRecoverExpiredTasks(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	// Claimed task with an already-expired lease
+	expired, _ := s.CreateTask("Expired", "")
+	if err := s.ClaimTask(expired.ID, "dead-worker"); err != nil {
+		t.Fatalf("ClaimTask failed: %v", err)
+	}
+	if _, err := s.CreateLease(expired.ID, "dead-worker", -1); err != nil {
+		t.Fatalf("CreateLease failed: %v", err)
+	}
+
+	// Claimed task with a live lease must be left alone
+	live, _ := s.CreateTask("Live", "")
+	if err := s.ClaimTask(live.ID, "live-worker"); err != nil {
+		t.Fatalf("ClaimTask failed: %v", err)
+	}
+	if _, err := s.CreateLease(live.ID, "live-worker", 300); err != nil {
+		t.Fatalf("CreateLease failed: %v", err)
+	}
+
+	recovered, err := s.RecoverExpiredTasks()
+	if err != nil {
+		t.Fatalf("RecoverExpiredTasks failed: %v", err)
+	}
+	if recovered != 1 {
+		t.Errorf("Expected 1 recovered task, got %d", recovered)
+	}
+
+	got, _ := s.GetTask(expired.ID)
+	if got.Status != models.TaskStatusPending {
+		t.Errorf("Expired task should be pending, got %s", got.Status)
+	}
+	got, _ = s.GetTask(live.ID)
+	if got.Status != models.TaskStatusClaimed {
+		t.Errorf("Live task should stay claimed, got %s", got.Status)
+	}
+}
+
 func TestRuns(t *testing.T) {
 	s := newTestStore(t)
 	defer s.Close()
@@ -182,7 +522,7 @@ func TestRuns(t *testing.T) {
 		t.Fatalf("UpdateRun failed: %v", err)
 	}
 
-	// Get runs
+	// Get runs: metadata only, output is fetched lazily
 	runs, err := s.GetRunsForTask(task.ID)
 	if err != nil {
 		t.Fatalf("GetRunsForTask failed: %v", err)
@@ -190,8 +530,57 @@ func TestRuns(t *testing.T) {
 	if len(runs) != 1 {
 		t.Errorf("Expected 1 run, got %d", len(runs))
 	}
-	if runs[0].Stdout != "stdout content" {
-		t.Errorf("Unexpected stdout: %s", runs[0].Stdout)
+	if runs[0].Stdout != "" {
+		t.Errorf("Run listing should not carry output, got %q", runs[0].Stdout)
+	}
+
+	stdout, stderr, err := s.GetRunOutput(run.ID)
+	if err != nil {
+		t.Fatalf("GetRunOutput failed: %v", err)
+	}
+	if stdout != "stdout content" {
+		t.Errorf("Unexpected stdout: %s", stdout)
+	}
+	if stderr != "" {
+		t.Errorf("Unexpected stderr: %s", stderr)
+	}
+}
+
+func TestRunLogChunking(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	task, _ := s.CreateTask("Test", "")
+	run, err := s.CreateRun(task.ID, "go", []string{"test"})
+	if err != nil {
+		t.Fatalf("CreateRun failed: %v", err)
+	}
+
+	// Large enough to span multiple chunks
+	big := strings.Repeat("0123456789abcdef", 40*1024) // 640 KiB
+	if err := s.AppendRunLog(run.ID, "stdout", []byte(big)); err != nil {
+		t.Fatalf("AppendRunLog failed: %v", err)
+	}
+	// A later append continues the sequence
+	if err := s.AppendRunLog(run.ID, "stdout", []byte("tail")); err != nil {
+		t.Fatalf("AppendRunLog failed: %v", err)
+	}
+
+	got, err := s.GetRunLog(run.ID, "stdout")
+	if err != nil {
+		t.Fatalf("GetRunLog failed: %v", err)
+	}
+	if got != big+"tail" {
+		t.Errorf("Reassembled log mismatch: got %d bytes, want %d", len(got), len(big)+4)
+	}
+
+	// Absent stream reads as empty
+	got, err = s.GetRunLog(run.ID, "stderr")
+	if err != nil {
+		t.Fatalf("GetRunLog failed: %v", err)
+	}
+	if got != "" {
+		t.Errorf("Expected empty stderr, got %d bytes", len(got))
 	}
 }
 
@@ -210,8 +599,8 @@ func TestMemory(t *testing.T) {
 		t.Error("Memory ID should not be empty")
 	}
 
-	// Query memory
-	items, err := s.QueryMemory("memory")
+	// Query memory via the FTS index
+	items, err := s.QueryMemory("memory", "")
 	if err != nil {
 		t.Fatalf("QueryMemory failed: %v", err)
 	}
@@ -219,6 +608,40 @@ func TestMemory(t *testing.T) {
 		t.Errorf("Expected 1 item, got %d", len(items))
 	}
 
+	// No match for absent terms
+	items, err = s.QueryMemory("nonexistent", "")
+	if err != nil {
+		t.Fatalf("QueryMemory failed: %v", err)
+	}
+	if len(items) != 0 {
+		t.Errorf("Expected 0 items, got %d", len(items))
+	}
+
+	// Tag-scoped query
+	items, err = s.QueryMemory("memory", "tag1")
+	if err != nil {
+		t.Fatalf("QueryMemory with tag failed: %v", err)
+	}
+	if len(items) != 1 {
+		t.Errorf("Expected 1 tagged item, got %d", len(items))
+	}
+	items, err = s.QueryMemory("memory", "othertag")
+	if err != nil {
+		t.Fatalf("QueryMemory with tag failed: %v", err)
+	}
+	if len(items) != 0 {
+		t.Errorf("Expected 0 items for unmatched tag, got %d", len(items))
+	}
+
+	// Empty query returns most recent items
+	items, err = s.QueryMemory("", "")
+	if err != nil {
+		t.Fatalf("QueryMemory with empty query failed: %v", err)
+	}
+	if len(items) != 1 {
+		t.Errorf("Expected 1 item for empty query, got %d", len(items))
+	}
+
 	// Get memory for task
 	items, err = s.GetMemoryForTask(task.ID)
 	if err != nil {
@@ -244,6 +667,192 @@ func TestPDR(t *testing.T) {
 	}
 }
 
+func TestWritePDRBatch(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	entries := make([]models.PDREntry, 3)
+	for i := range entries {
+		entries[i] = models.PDREntry{
+			ID:         fmt.Sprintf("pdr-%d", i),
+			Action:     "test.action",
+			InputsHash: "abc123",
+			Outcome:    "success",
+			Timestamp:  time.Now().UTC(),
+		}
+	}
+
+	if err := s.WritePDRBatch(entries); err != nil {
+		t.Fatalf("WritePDRBatch failed: %v", err)
+	}
+
+	// Empty batch is a no-op
+	if err := s.WritePDRBatch(nil); err != nil {
+		t.Errorf("WritePDRBatch(nil) should be a no-op, got %v", err)
+	}
+}
+
+func TestArchiveTasks(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	done, err := s.CreateTask("Finished work", "to be archived")
+	if err != nil {
+		t.Fatalf("CreateTask failed: %v", err)
+	}
+	if _, err := s.CreateLease(done.ID, "holder-1", 300); err != nil {
+		t.Fatalf("CreateLease failed: %v", err)
+	}
+	run, err := s.CreateRun(done.ID, "echo", []string{"hi"})
+	if err != nil {
+		t.Fatalf("CreateRun failed: %v", err)
+	}
+	if err := s.UpdateRun(run.ID, 0, "hi\n", ""); err != nil {
+		t.Fatalf("UpdateRun failed: %v", err)
+	}
+	if err := s.UpdateTaskStatus(done.ID, models.TaskStatusCompleted); err != nil {
+		t.Fatalf("UpdateTaskStatus failed: %v", err)
+	}
+
+	pending, err := s.CreateTask("Still pending", "")
+	if err != nil {
+		t.Fatalf("CreateTask failed: %v", err)
+	}
+
+	// Everything finished before the (future) cutoff is archived
+	n, err := s.ArchiveTasks(time.Now().UTC().Add(time.Minute))
+	if err != nil {
+		t.Fatalf("ArchiveTasks failed: %v", err)
+	}
+	if n != 1 {
+		t.Fatalf("Expected 1 task archived, got %d", n)
+	}
+
+	// Archived task is gone from the hot tables; pending task is untouched
+	if got, _ := s.GetTask(done.ID); got != nil {
+		t.Error("Archived task should be gone from the hot database")
+	}
+	if got, _ := s.GetTask(pending.ID); got == nil {
+		t.Error("Pending task should not be archived")
+	}
+	if runs, _ := s.GetRunsForTask(done.ID); len(runs) != 0 {
+		t.Errorf("Expected 0 hot runs after archival, got %d", len(runs))
+	}
+
+	// Cold-storage lookup returns the full record including run output
+	record, err := s.GetArchivedTask(done.ID)
+	if err != nil {
+		t.Fatalf("GetArchivedTask failed: %v", err)
+	}
+	if record == nil {
+		t.Fatal("Expected archived record, got nil")
+	}
+	if record.Task.Title != "Finished work" {
+		t.Errorf("Archived title = %q, want %q", record.Task.Title, "Finished work")
+	}
+	if len(record.Runs) != 1 || record.Runs[0].Stdout != "hi\n" {
+		t.Errorf("Archived runs not preserved: %+v", record.Runs)
+	}
+	if len(record.Leases) != 1 || record.Leases[0].HolderID != "holder-1" {
+		t.Errorf("Archived leases not preserved: %+v", record.Leases)
+	}
+
+	// Never-archived tasks miss cleanly; a second pass is a no-op
+	if got, err := s.GetArchivedTask(pending.ID); err != nil || got != nil {
+		t.Errorf("Expected nil for unarchived task, got %v, %v", got, err)
+	}
+	if n, err := s.ArchiveTasks(time.Now().UTC().Add(time.Minute)); err != nil || n != 0 {
+		t.Errorf("Expected 0 tasks on second pass, got %d (err %v)", n, err)
+	}
+}
+
+func TestPDRCompactAndQuery(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	now := time.Now().UTC()
+	old := now.Add(-48 * time.Hour)
+
+	entries := []models.PDREntry{
+		{ID: "old-1", Action: "task.run", InputsHash: "h", Outcome: "success", TaskID: "t1", Timestamp: old},
+		{ID: "old-2", Action: "task.run", InputsHash: "h", Outcome: "failed", TaskID: "t1", Timestamp: old.Add(time.Minute)},
+		{ID: "old-3", Action: "task.claim", InputsHash: "h", Outcome: "success", TaskID: "t2", Timestamp: old.Add(2 * time.Minute)},
+		{ID: "new-1", Action: "task.run", InputsHash: "h", Outcome: "success", TaskID: "t2", Timestamp: now},
+	}
+	if err := s.WritePDRBatch(entries); err != nil {
+		t.Fatalf("WritePDRBatch failed: %v", err)
+	}
+
+	// Filters: action
+	got, err := s.QueryPDR(time.Time{}, time.Time{}, "task.run", "", 0)
+	if err != nil {
+		t.Fatalf("QueryPDR failed: %v", err)
+	}
+	if len(got) != 3 {
+		t.Errorf("Expected 3 task.run records, got %d", len(got))
+	}
+
+	// Filters: task ID and time range
+	got, err = s.QueryPDR(now.Add(-time.Hour), time.Time{}, "", "t2", 0)
+	if err != nil {
+		t.Fatalf("QueryPDR failed: %v", err)
+	}
+	if len(got) != 1 || got[0].ID != "new-1" {
+		t.Errorf("Expected only new-1 for t2 in the last hour, got %v", got)
+	}
+
+	// Compact everything older than a day
+	n, err := s.CompactPDR(now.Add(-24 * time.Hour))
+	if err != nil {
+		t.Fatalf("CompactPDR failed: %v", err)
+	}
+	if n != 3 {
+		t.Errorf("Expected 3 records compacted, got %d", n)
+	}
+
+	// Raw records older than the cutoff are gone; recent ones remain
+	got, err = s.QueryPDR(time.Time{}, time.Time{}, "", "", 0)
+	if err != nil {
+		t.Fatalf("QueryPDR failed: %v", err)
+	}
+	if len(got) != 1 || got[0].ID != "new-1" {
+		t.Errorf("Expected only new-1 after compaction, got %v", got)
+	}
+
+	// Rollups aggregate the compacted records by day/action/outcome
+	rollups, err := s.QueryPDRRollups(time.Time{}, time.Time{}, "")
+	if err != nil {
+		t.Fatalf("QueryPDRRollups failed: %v", err)
+	}
+	counts := make(map[string]int)
+	for _, r := range rollups {
+		counts[r.Action+"/"+r.Outcome] += r.Count
+	}
+	if counts["task.run/success"] != 1 || counts["task.run/failed"] != 1 || counts["task.claim/success"] != 1 {
+		t.Errorf("Unexpected rollup counts: %v", counts)
+	}
+
+	// A second compaction of the same window accumulates, not duplicates
+	if err := s.WritePDRBatch([]models.PDREntry{
+		{ID: "old-4", Action: "task.run", InputsHash: "h", Outcome: "success", TaskID: "t1", Timestamp: old},
+	}); err != nil {
+		t.Fatalf("WritePDRBatch failed: %v", err)
+	}
+	if _, err := s.CompactPDR(now.Add(-24 * time.Hour)); err != nil {
+		t.Fatalf("CompactPDR failed: %v", err)
+	}
+	rollups, _ = s.QueryPDRRollups(time.Time{}, time.Time{}, "task.run")
+	total := 0
+	for _, r := range rollups {
+		if r.Outcome == "success" {
+			total += r.Count
+		}
+	}
+	if total != 2 {
+		t.Errorf("Expected rollup count 2 for task.run/success after second compaction, got %d", total)
+	}
+}
+
 func TestClaimTaskWithLeaseTx_Atomicity(t *testing.T) {
 	s := newTestStore(t)
 	defer s.Close()
@@ -336,6 +945,59 @@ func TestClaimTaskWithLeaseTx_NotClaimableStatus(t *testing.T) {
 	}
 }
 
+func TestAtomicClaimTasks_Batch(t *testing.T) {
+	s := newTestStore(t)
+	defer s.Close()
+
+	// Create 5 pending tasks
+	for i := 0; i < 5; i++ {
+		if _, err := s.CreateTask(fmt.Sprintf("Task %d", i), ""); err != nil {
+			t.Fatalf("CreateTask failed: %v", err)
+		}
+	}
+
+	// Claim up to 3 in one transaction
+	claims, err := s.AtomicClaimTasks("worker-", 3, 300)
+	if err != nil {
+		t.Fatalf("AtomicClaimTasks failed: %v", err)
+	}
+	if len(claims) != 3 {
+		t.Fatalf("Expected 3 claims, got %d", len(claims))
+	}
+
+	seen := make(map[string]bool)
+	for _, c := range claims {
+		if c.Task.Status != models.TaskStatusClaimed {
+			t.Errorf("Expected claimed status, got %s", c.Task.Status)
+		}
+		if c.Lease == nil || c.Lease.HolderID != c.Task.ClaimedBy {
+			t.Error("Lease holder should match task claimer")
+		}
+		if seen[c.Task.ID] {
+			t.Errorf("Task %s claimed twice in one batch", c.Task.ID)
+		}
+		seen[c.Task.ID] = true
+	}
+
+	// A second batch drains the remaining 2
+	claims, err = s.AtomicClaimTasks("worker-", 3, 300)
+	if err != nil {
+		t.Fatalf("AtomicClaimTasks failed: %v", err)
+	}
+	if len(claims) != 2 {
+		t.Errorf("Expected 2 remaining claims, got %d", len(claims))
+	}
+
+	// Nothing left to claim
+	claims, err = s.AtomicClaimTasks("worker-", 3, 300)
+	if err != nil {
+		t.Fatalf("AtomicClaimTasks failed: %v", err)
+	}
+	if len(claims) != 0 {
+		t.Errorf("Expected no claims on empty queue, got %d", len(claims))
+	}
+}
+
 func TestAcquireLock_Race(t *testing.T) {
 	s := newTestStore(t)
 	defer s.Close()
@@ -467,6 +1129,44 @@ func TestAcquireLock_ReleaseLock(t *testing.T) {
 	}
 }
 
+func TestAcquireLock_PersistsAcrossRestart(t *testing.T) {
+	tmpDir := t.TempDir()
+	dbPath := filepath.Join(tmpDir, "test.db")
+
+	s, err := New(dbPath)
+	if err != nil {
+		t.Fatalf("Failed to create store: %v", err)
+	}
+
+	lock, err := s.AcquireLock("shared-resource", "holder-1", "exclusive", 300)
+	if err != nil {
+		t.Fatalf("AcquireLock failed: %v", err)
+	}
+
+	// Close flushes the in-memory table; a new store must recover it
+	if err := s.Close(); err != nil {
+		t.Fatalf("Close failed: %v", err)
+	}
+
+	s2, err := New(dbPath)
+	if err != nil {
+		t.Fatalf("Failed to reopen store: %v", err)
+	}
+	defer s2.Close()
+
+	got, err := s2.GetLock("shared-resource")
+	if err != nil {
+		t.Fatalf("GetLock failed: %v", err)
+	}
+	if got == nil || got.ID != lock.ID || got.HolderID != "holder-1" {
+		t.Errorf("Lock not recovered after restart: %+v", got)
+	}
+
+	if _, err := s2.AcquireLock("shared-resource", "holder-2", "exclusive", 300); err != ErrResourceLocked {
+		t.Errorf("Expected ErrResourceLocked after restart, got: %v", err)
+	}
+}
+
 func TestPing(t *testing.T) {
 	s := newTestStore(t)
 	defer s.Close()
@@ -81,6 +81,7 @@ type App struct {
 	filter       string
 	filterIdx    int
 	loading      bool
+	detector     *agents.Detector
 	agents       []agents.Agent
 	agentIdx     int
 	daemonOnline bool
@@ -88,6 +89,14 @@ type App struct {
 	workersStats *WorkersStats
 	authManager  *auth.Manager
 	currentUser  *auth.User
+	eventCh      <-chan string
+
+	// Render caches: rowCache memoizes styled task rows by
+	// (id, status, selected); frame holds the last full frame so View can
+	// skip rebuilding when nothing user-visible changed.
+	rowCache   map[string]string
+	frame      string
+	frameDirty bool
 }
 
 var filters = []string{"", "pending", "claimed", "running", "completed", "failed"}
@@ -103,10 +112,6 @@ func New(apiAddr string) *App {
 
 	vp := viewport.New(80, 20)
 
-	// Detect agents on startup
-	detector := agents.NewDetector()
-	detectedAgents := detector.Scan()
-
 	// Initialize auth manager
 	authMgr, _ := auth.NewManager()
 	var currentUser *auth.User
@@ -119,10 +124,11 @@ func New(apiAddr string) *App {
 		input:       ti,
 		viewport:    vp,
 		mode:        "list",
-		agents:      detectedAgents,
+		detector:    agents.NewDetector(),
 		suggestions: NewSuggestions(),
 		authManager: authMgr,
 		currentUser: currentUser,
+		rowCache:    make(map[string]string),
 	}
 }
 
@@ -139,6 +145,9 @@ func (a *App) Init() tea.Cmd {
 		textinput.Blink,
 		a.fetchTasks(),
 		a.checkDaemon(),
+		a.connectEvents(),
+		// Agent detection spawns subprocesses; run it off the startup path
+		a.scanAgents(),
 	)
 }
 
@@ -146,6 +155,11 @@ func (a *App) Init() tea.Cmd {
 func (a *App) Update(msg tea.Msg) (tea.Model, tea.Cmd) {
 	var cmds []tea.Cmd
 
+	// Assume the message changed something user-visible; the branches that
+	// only schedule follow-up work (ticks, event re-arms) clear this so View
+	// serves the cached frame instead of restyling everything.
+	a.frameDirty = true
+
 	switch msg := msg.(type) {
 	case tea.KeyMsg:
 		switch msg.String() {
@@ -267,10 +281,43 @@ func (a *App) Update(msg tea.Msg) (tea.Model, tea.Cmd) {
 		}
 
 	case tickMsg:
+		a.frameDirty = false
 		if a.mode == "workers" {
 			return a, a.fetchWorkers()
 		}
 
+	case eventsConnectedMsg:
+		a.eventCh = msg.ch
+		a.daemonOnline = true
+		cmds = append(cmds, a.waitForEvent())
+
+	case eventMsg:
+		// Push-driven refresh: reload only what the current view shows.
+		// The fetch result redraws; the event itself doesn't.
+		a.frameDirty = false
+		cmds = append(cmds, a.waitForEvent())
+		switch a.mode {
+		case "list":
+			cmds = append(cmds, a.refreshTasks())
+		case "workers":
+			cmds = append(cmds, a.fetchWorkers())
+		case "detail":
+			if a.currentTask != nil {
+				cmds = append(cmds, a.fetchTaskDetail(a.currentTask.ID))
+			}
+		}
+
+	case eventsLostMsg:
+		a.eventCh = nil
+		a.daemonOnline = false
+		cmds = append(cmds, tea.Tick(5*time.Second, func(time.Time) tea.Msg {
+			return reconnectEventsMsg{}
+		}))
+
+	case reconnectEventsMsg:
+		a.frameDirty = false
+		cmds = append(cmds, a.connectEvents())
+
 	case commandResultMsg:
 		a.message = msg.message
 		return a, a.fetchTasks()
@@ -307,6 +354,11 @@ func (a *App) Update(msg tea.Msg) (tea.Model, tea.Cmd) {
 
 // View implements tea.Model
 func (a *App) View() string {
+	// Serve the cached frame when Update changed nothing user-visible
+	if !a.frameDirty && a.frame != "" {
+		return a.frame
+	}
+
 	var b strings.Builder
 
 	// Header with daemon status
@@ -388,9 +440,15 @@ func (a *App) View() string {
 	}
 	b.WriteString(statusBarStyle.Width(a.width).Render(status))
 
-	return b.String()
+	a.frame = b.String()
+	a.frameDirty = false
+	return a.frame
 }
 
+// renderTaskList styles only the rows inside the visible window, so cost
+// scales with screen height rather than task count. Rendered rows are
+// memoized by (task ID, status, selected); scrolling or a push refresh
+// restyles just the rows that actually changed.
 func (a *App) renderTaskList(height int) string {
 	if a.loading {
 		return "\n  Loading tasks...\n"
@@ -399,31 +457,47 @@ func (a *App) renderTaskList(height int) string {
 		return "\n  No tasks found. Type: add <title> to create one.\n"
 	}
 
-	var lines []string
-	for i, task := range a.tasks {
-		status := a.formatStatus(task.Status)
-
-		if i == a.selectedIdx {
-			line := selectedStyle.Render(fmt.Sprintf("▶ %s  %s", a.formatStatusPlain(task.Status), task.TaskTitle))
-			lines = append(lines, line)
-		} else {
-			line := taskItemStyle.Render(fmt.Sprintf("  %s  %s", status, task.TaskTitle))
-			lines = append(lines, line)
+	// Visible window, centered on the selection
+	start := 0
+	if len(a.tasks) > height {
+		start = a.selectedIdx - height/2
+		if start < 0 {
+			start = 0
+		}
+		if start+height > len(a.tasks) {
+			start = len(a.tasks) - height
 		}
 	}
+	end := start + height
+	if end > len(a.tasks) {
+		end = len(a.tasks)
+	}
 
-	// Limit visible lines
-	if len(lines) > height {
-		start := a.selectedIdx - height/2
-		if start < 0 {
-			start = 0
+	// Drop stale entries (deleted tasks, old selections) once the cache
+	// clearly outgrows the list
+	if len(a.rowCache) > 2*len(a.tasks)+64 {
+		a.rowCache = make(map[string]string)
+	}
+
+	lines := make([]string, 0, end-start)
+	for i := start; i < end; i++ {
+		task := a.tasks[i]
+		selected := i == a.selectedIdx
+
+		key := task.ID + "|" + task.Status
+		if selected {
+			key += "|sel"
 		}
-		end := start + height
-		if end > len(lines) {
-			end = len(lines)
-			start = max(0, end-height)
+		line, ok := a.rowCache[key]
+		if !ok {
+			if selected {
+				line = selectedStyle.Render(fmt.Sprintf("▶ %s  %s", a.formatStatusPlain(task.Status), task.TaskTitle))
+			} else {
+				line = taskItemStyle.Render(fmt.Sprintf("  %s  %s", a.formatStatus(task.Status), task.TaskTitle))
+			}
+			a.rowCache[key] = line
 		}
-		lines = lines[start:end]
+		lines = append(lines, line)
 	}
 
 	return strings.Join(lines, "\n")
@@ -569,6 +643,46 @@ func (a *App) fetchTasks() tea.Cmd {
 	}
 }
 
+// refreshTasks reloads the task list without flipping the loading indicator,
+// so push-driven updates don't flicker the view.
+func (a *App) refreshTasks() tea.Cmd {
+	return func() tea.Msg {
+		tasks, err := a.client.ListTasks(a.filter)
+		if err != nil {
+			return errMsg{err}
+		}
+		return tasksLoadedMsg{tasks}
+	}
+}
+
+// connectEvents opens the daemon's /events stream. On failure the app falls
+// back to a reconnect timer, so a restarting daemon is picked up again.
+func (a *App) connectEvents() tea.Cmd {
+	return func() tea.Msg {
+		ch, err := a.client.WatchEvents(context.Background())
+		if err != nil {
+			return eventsLostMsg{}
+		}
+		return eventsConnectedMsg{ch}
+	}
+}
+
+// waitForEvent blocks on the event stream and converts the next event into a
+// message; it re-arms itself from Update after each event.
+func (a *App) waitForEvent() tea.Cmd {
+	ch := a.eventCh
+	return func() tea.Msg {
+		if ch == nil {
+			return nil
+		}
+		name, ok := <-ch
+		if !ok {
+			return eventsLostMsg{}
+		}
+		return eventMsg{name}
+	}
+}
+
 func (a *App) fetchTaskDetail(taskID string) tea.Cmd {
 	return func() tea.Msg {
 		task, err := a.client.GetTask(taskID)
@@ -583,8 +697,7 @@ func (a *App) fetchTaskDetail(taskID string) tea.Cmd {
 
 func (a *App) scanAgents() tea.Cmd {
 	return func() tea.Msg {
-		detector := agents.NewDetector()
-		found := detector.Scan()
+		found := a.detector.Scan()
 		return agentsScanMsg{found}
 	}
 }
@@ -680,8 +793,8 @@ func (a *App) executeCommand(input string) tea.Cmd {
 			return commandResultMsg{fmt.Sprintf("Found %d items", len(items))}
 
 		case "scan":
-			detector := agents.NewDetector()
-			found := detector.Scan()
+			// Explicit scan bypasses the detector's TTL cache
+			found := a.detector.Rescan()
 			a.agents = found
 			return commandResultMsg{fmt.Sprintf("✓ Detected %d agents", len(found))}
 
@@ -792,6 +905,18 @@ type workersFetchedMsg struct {
 	stats *WorkersStats
 }
 
+type eventsConnectedMsg struct {
+	ch <-chan string
+}
+
+type eventMsg struct {
+	name string
+}
+
+type eventsLostMsg struct{}
+
+type reconnectEventsMsg struct{}
+
 type tickMsg time.Time
 
 func (a *App) fetchWorkers() tea.Cmd {
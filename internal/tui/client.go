@@ -1,14 +1,20 @@
 package tui
 
 import (
+	"bufio"
 	"bytes"
+	"context"
 	"encoding/json"
 	"fmt"
 	"io"
 	"net/http"
 	"net/url"
 	"os"
+	"strings"
+	"sync"
 	"time"
+
+	"github.com/fentz26/neona/internal/apiclient"
 )
 
 // DefaultClientTimeout is the default timeout for API requests.
@@ -19,36 +25,89 @@ type Client struct {
 	baseURL    string
 	holderID   string
 	httpClient *http.Client
+	// streamClient has no timeout: it carries the long-lived /events stream
+	streamClient *http.Client
+
+	// listCache remembers the last list response per request URL along with
+	// its ETag, so steady-state refreshes cost a 304 header exchange.
+	mu        sync.Mutex
+	listCache map[string]*cachedTaskList
 }
 
-// NewClient creates a new API client with timeout
+type cachedTaskList struct {
+	etag  string
+	items []TaskItem
+	next  string
+}
+
+// NewClient creates a new API client with timeout. Both clients prefer the
+// daemon's unix socket when present, falling back to the TCP base URL.
 func NewClient(baseURL string) *Client {
 	hostname, _ := os.Hostname()
 	return &Client{
-		baseURL:  baseURL,
-		holderID: fmt.Sprintf("tui@%s", hostname),
-		httpClient: &http.Client{
-			Timeout: DefaultClientTimeout,
-		},
+		baseURL:      baseURL,
+		holderID:     fmt.Sprintf("tui@%s", hostname),
+		httpClient:   apiclient.New(DefaultClientTimeout),
+		streamClient: apiclient.New(0),
+		listCache:    make(map[string]*cachedTaskList),
 	}
 }
 
-// ListTasks fetches tasks from the API
+// DefaultListLimit is how many tasks ListTasks fetches per refresh; the TUI
+// never renders more than this at once.
+const DefaultListLimit = 200
+
+// ListTasks fetches the first page of tasks from the API
 func (c *Client) ListTasks(status string) ([]TaskItem, error) {
-	url := c.baseURL + "/tasks"
+	items, _, err := c.ListTasksPage(status, "", DefaultListLimit)
+	return items, err
+}
+
+// ListTasksPage fetches one page of tasks. cursor is the value returned by a
+// previous call ("" for the first page); the returned cursor is "" when no
+// further pages exist.
+func (c *Client) ListTasksPage(status, cursor string, limit int) ([]TaskItem, string, error) {
+	params := url.Values{}
 	if status != "" {
-		url += "?status=" + status
+		params.Set("status", status)
+	}
+	if cursor != "" {
+		params.Set("cursor", cursor)
+	}
+	if limit > 0 {
+		params.Set("limit", fmt.Sprintf("%d", limit))
 	}
 
-	resp, err := c.httpClient.Get(url)
+	reqURL := c.baseURL + "/tasks"
+	if len(params) > 0 {
+		reqURL += "?" + params.Encode()
+	}
+
+	c.mu.Lock()
+	cached := c.listCache[reqURL]
+	c.mu.Unlock()
+
+	req, err := http.NewRequest(http.MethodGet, reqURL, nil)
 	if err != nil {
-		return nil, err
+		return nil, "", err
+	}
+	if cached != nil {
+		req.Header.Set("If-None-Match", cached.etag)
+	}
+
+	resp, err := c.httpClient.Do(req)
+	if err != nil {
+		return nil, "", err
 	}
 	defer resp.Body.Close()
 
+	if resp.StatusCode == http.StatusNotModified && cached != nil {
+		return cached.items, cached.next, nil
+	}
+
 	if resp.StatusCode >= 400 {
 		body, _ := io.ReadAll(resp.Body)
-		return nil, fmt.Errorf("API error: %s", string(body))
+		return nil, "", fmt.Errorf("API error: %s", string(body))
 	}
 
 	var tasks []struct {
@@ -58,7 +117,7 @@ func (c *Client) ListTasks(status string) ([]TaskItem, error) {
 		ClaimedBy string `json:"claimed_by"`
 	}
 	if err := json.NewDecoder(resp.Body).Decode(&tasks); err != nil {
-		return nil, err
+		return nil, "", err
 	}
 
 	items := make([]TaskItem, len(tasks))
@@ -70,7 +129,14 @@ func (c *Client) ListTasks(status string) ([]TaskItem, error) {
 			ClaimedBy: t.ClaimedBy,
 		}
 	}
-	return items, nil
+
+	next := resp.Header.Get("X-Next-Cursor")
+	if etag := resp.Header.Get("ETag"); etag != "" {
+		c.mu.Lock()
+		c.listCache[reqURL] = &cachedTaskList{etag: etag, items: items, next: next}
+		c.mu.Unlock()
+	}
+	return items, next, nil
 }
 
 // GetTask fetches a single task
@@ -325,6 +391,50 @@ func (c *Client) CheckHealth() (bool, error) {
 	return health.OK, nil
 }
 
+// WatchEvents subscribes to the daemon's /events server-sent events stream
+// and returns a channel of event types (e.g. "task.created"). The channel is
+// closed when the stream ends or ctx is cancelled; callers refresh the
+// affected views on each event instead of polling.
+func (c *Client) WatchEvents(ctx context.Context) (<-chan string, error) {
+	req, err := http.NewRequestWithContext(ctx, http.MethodGet, c.baseURL+"/events", nil)
+	if err != nil {
+		return nil, err
+	}
+
+	resp, err := c.streamClient.Do(req)
+	if err != nil {
+		return nil, err
+	}
+	if resp.StatusCode != http.StatusOK {
+		resp.Body.Close()
+		return nil, fmt.Errorf("events stream unavailable: %s", resp.Status)
+	}
+
+	ch := make(chan string, 16)
+	go func() {
+		defer resp.Body.Close()
+		defer close(ch)
+
+		scanner := bufio.NewScanner(resp.Body)
+		event := ""
+		for scanner.Scan() {
+			line := scanner.Text()
+			switch {
+			case strings.HasPrefix(line, "event:"):
+				event = strings.TrimSpace(strings.TrimPrefix(line, "event:"))
+			case line == "" && event != "":
+				select {
+				case ch <- event:
+				default:
+					// Consumer is behind; it will resync on its next refresh
+				}
+				event = ""
+			}
+		}
+	}()
+	return ch, nil
+}
+
 // GetWorkers fetches worker pool statistics from the daemon
 func (c *Client) GetWorkers() (*WorkersStats, error) {
 	resp, err := c.httpClient.Get(c.baseURL + "/workers")
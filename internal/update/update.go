@@ -2,6 +2,8 @@
 package update
 
 import (
+	"crypto/sha256"
+	"encoding/hex"
 	"encoding/json"
 	"fmt"
 	"io"
@@ -48,6 +50,9 @@ type UpdateCache struct {
 	LastCheck     int64  `json:"last_check"`
 	LatestVersion string `json:"latest_version"`
 	DownloadURL   string `json:"download_url"`
+	AssetName     string `json:"asset_name,omitempty"`
+	AssetSize     int64  `json:"asset_size,omitempty"`
+	ChecksumURL   string `json:"checksum_url,omitempty"`
 }
 
 // Checker handles update checking and caching.
@@ -126,13 +131,19 @@ func (c *Checker) CheckForUpdate() (bool, string, error) {
 	currentVersion := strings.TrimPrefix(Version, "v")
 
 	// Find the appropriate asset for this OS/arch
-	downloadURL := findAssetURL(release.Assets)
+	asset := findAsset(release.Assets)
 
-	// Update cache
+	// Update cache; asset size and checksum URL let the installer resume
+	// and verify interrupted downloads
 	c.cache = &UpdateCache{
 		LastCheck:     time.Now().Unix(),
 		LatestVersion: latestVersion,
-		DownloadURL:   downloadURL,
+		ChecksumURL:   findChecksumURL(release.Assets),
+	}
+	if asset != nil {
+		c.cache.DownloadURL = asset.BrowserDownloadURL
+		c.cache.AssetName = asset.Name
+		c.cache.AssetSize = asset.Size
 	}
 	_ = c.saveCache()
 
@@ -160,6 +171,17 @@ func (c *Checker) GetDownloadURL() string {
 
 // DownloadAndInstall downloads and installs the latest version.
 func (c *Checker) DownloadAndInstall() error {
+	return c.downloadAndInstall(nil)
+}
+
+// downloadAndInstall fetches the release asset (resuming any interrupted
+// previous attempt), verifies it, and swaps it in for the running binary.
+// logf, when non-nil, receives progress lines for the TUI flow.
+func (c *Checker) downloadAndInstall(logf func(string)) error {
+	if logf == nil {
+		logf = func(string) {}
+	}
+
 	if c.cache == nil || c.cache.DownloadURL == "" {
 		// Try to get fresh release info
 		_, _, err := c.CheckForUpdate()
@@ -173,34 +195,28 @@ func (c *Checker) DownloadAndInstall() error {
 		return fmt.Errorf("no download URL available for %s/%s", runtime.GOOS, runtime.GOARCH)
 	}
 
-	// Download to temp file
-	// Download to temp file
-
-	resp, err := http.Get(downloadURL)
-	if err != nil {
-		return fmt.Errorf("failed to download: %w", err)
-	}
-	defer resp.Body.Close()
-
-	if resp.StatusCode != http.StatusOK {
-		return fmt.Errorf("download failed with status %d", resp.StatusCode)
+	// Download into a stable .partial file keyed by asset name, so a retry
+	// after a dropped transfer resumes instead of starting over
+	assetName := c.cache.AssetName
+	if assetName == "" {
+		assetName = filepath.Base(downloadURL)
 	}
+	partialPath := filepath.Join(c.configDir, assetName+".partial")
 
-	tmpFile, err := os.CreateTemp("", "neona-update-*")
-	if err != nil {
-		return fmt.Errorf("failed to create temp file: %w", err)
+	logf(fmt.Sprintf("Downloading from: %s...", shortURL(downloadURL)))
+	if err := c.downloadResumable(downloadURL, partialPath, c.cache.AssetSize, logf); err != nil {
+		// Leave the partial file behind; the next attempt resumes from it
+		return err
 	}
-	tmpPath := tmpFile.Name()
-	defer os.Remove(tmpPath)
 
-	_, err = io.Copy(tmpFile, resp.Body)
-	tmpFile.Close()
-	if err != nil {
-		return fmt.Errorf("failed to download binary: %w", err)
+	logf("Verifying download...")
+	if err := c.verifyDownload(partialPath, assetName); err != nil {
+		os.Remove(partialPath) // corrupt; force a fresh download next time
+		return err
 	}
 
 	// Make executable
-	if err := os.Chmod(tmpPath, 0755); err != nil {
+	if err := os.Chmod(partialPath, 0755); err != nil {
 		return fmt.Errorf("failed to set permissions: %w", err)
 	}
 
@@ -211,11 +227,9 @@ func (c *Checker) DownloadAndInstall() error {
 	}
 	currentBin, _ = filepath.EvalSymlinks(currentBin)
 
-	// Replace the binary
-	// Replace the binary
-
 	// On some systems, we can't replace a running binary directly
 	// Use a temporary rename approach
+	logf("Replacing old binary...")
 	backupPath := currentBin + ".old"
 	os.Remove(backupPath) // Remove old backup if exists
 
@@ -223,17 +237,159 @@ func (c *Checker) DownloadAndInstall() error {
 		return fmt.Errorf("failed to backup current binary: %w", err)
 	}
 
-	if err := copyFile(tmpPath, currentBin); err != nil {
+	if err := copyFile(partialPath, currentBin); err != nil {
 		// Try to restore backup
 		os.Rename(backupPath, currentBin)
 		return fmt.Errorf("failed to install new binary: %w", err)
 	}
 
-	os.Remove(backupPath) // Clean up backup
+	os.Remove(backupPath)  // Clean up backup
+	os.Remove(partialPath) // Download fully installed
 
 	return nil
 }
 
+// downloadResumable fetches url into partialPath. When a previous attempt
+// left bytes behind, it asks the server for the remainder with an HTTP
+// Range request, so a dropped transfer on a slow link costs only the
+// missing bytes. Servers that ignore Range get a full re-download.
+func (c *Checker) downloadResumable(url, partialPath string, expectedSize int64, logf func(string)) error {
+	f, err := os.OpenFile(partialPath, os.O_CREATE|os.O_WRONLY|os.O_APPEND, 0600)
+	if err != nil {
+		return fmt.Errorf("failed to open partial file: %w", err)
+	}
+	defer f.Close()
+
+	var offset int64
+	if info, err := f.Stat(); err == nil {
+		offset = info.Size()
+	}
+	if expectedSize > 0 && offset == expectedSize {
+		return nil // previous attempt finished downloading but wasn't installed
+	}
+	if expectedSize > 0 && offset > expectedSize {
+		// Stale partial from a different release; start over
+		offset = 0
+		if err := f.Truncate(0); err != nil {
+			return fmt.Errorf("failed to reset partial file: %w", err)
+		}
+	}
+
+	req, err := http.NewRequest(http.MethodGet, url, nil)
+	if err != nil {
+		return fmt.Errorf("failed to build request: %w", err)
+	}
+	if offset > 0 {
+		req.Header.Set("Range", fmt.Sprintf("bytes=%d-", offset))
+		logf(fmt.Sprintf("Resuming download at byte %d...", offset))
+	}
+
+	resp, err := http.DefaultClient.Do(req)
+	if err != nil {
+		return fmt.Errorf("failed to download: %w", err)
+	}
+	defer resp.Body.Close()
+
+	switch resp.StatusCode {
+	case http.StatusPartialContent:
+		// Server honors the range; body is the remainder, appended below
+	case http.StatusOK:
+		// Range ignored; the body is the whole asset
+		if offset > 0 {
+			if err := f.Truncate(0); err != nil {
+				return fmt.Errorf("failed to reset partial file: %w", err)
+			}
+		}
+	case http.StatusRequestedRangeNotSatisfiable:
+		// Partial doesn't match the remote asset (new release since the
+		// last attempt); discard it and fetch from scratch
+		if err := f.Truncate(0); err != nil {
+			return fmt.Errorf("failed to reset partial file: %w", err)
+		}
+		f.Close()
+		return c.downloadResumable(url, partialPath, expectedSize, logf)
+	default:
+		return fmt.Errorf("download failed with status %d", resp.StatusCode)
+	}
+
+	if _, err := io.Copy(f, resp.Body); err != nil {
+		return fmt.Errorf("failed to download binary: %w", err)
+	}
+	return nil
+}
+
+// verifyDownload checks the completed download against the release's
+// published checksums when available, plus the asset size from the release
+// metadata. A mismatch means a corrupt or truncated transfer.
+func (c *Checker) verifyDownload(path, assetName string) error {
+	if c.cache.AssetSize > 0 {
+		info, err := os.Stat(path)
+		if err != nil {
+			return fmt.Errorf("failed to stat download: %w", err)
+		}
+		if info.Size() != c.cache.AssetSize {
+			return fmt.Errorf("downloaded %d bytes, expected %d", info.Size(), c.cache.AssetSize)
+		}
+	}
+
+	if c.cache.ChecksumURL == "" {
+		return nil // release publishes no checksums; size check is all we have
+	}
+	want, err := fetchChecksum(c.cache.ChecksumURL, assetName)
+	if err != nil || want == "" {
+		return nil // checksums asset unavailable or doesn't list our asset
+	}
+
+	f, err := os.Open(path)
+	if err != nil {
+		return fmt.Errorf("failed to open download: %w", err)
+	}
+	defer f.Close()
+
+	h := sha256.New()
+	if _, err := io.Copy(h, f); err != nil {
+		return fmt.Errorf("failed to hash download: %w", err)
+	}
+	got := hex.EncodeToString(h.Sum(nil))
+	if !strings.EqualFold(got, want) {
+		return fmt.Errorf("checksum mismatch: got %s, want %s", got, want)
+	}
+	return nil
+}
+
+// fetchChecksum downloads the release's checksums asset and returns the hex
+// digest listed for assetName ("" when not listed). Lines follow the usual
+// "<sha256>  <filename>" format.
+func fetchChecksum(url, assetName string) (string, error) {
+	client := &http.Client{Timeout: 10 * time.Second}
+	resp, err := client.Get(url)
+	if err != nil {
+		return "", err
+	}
+	defer resp.Body.Close()
+
+	if resp.StatusCode != http.StatusOK {
+		return "", fmt.Errorf("checksum fetch returned status %d", resp.StatusCode)
+	}
+
+	data, err := io.ReadAll(io.LimitReader(resp.Body, 1<<20))
+	if err != nil {
+		return "", err
+	}
+	for _, line := range strings.Split(string(data), "\n") {
+		fields := strings.Fields(line)
+		if len(fields) < 2 {
+			continue
+		}
+		// Some generators mark binary mode with a leading "*"
+		name := strings.TrimPrefix(fields[len(fields)-1], "*")
+		if name == assetName {
+			return fields[0], nil
+		}
+	}
+	return "", nil
+}
+
 // cachePath returns the path to the cache file.
 func (c *Checker) cachePath() string {
 	return filepath.Join(c.configDir, "update_cache.json")
@@ -269,8 +425,8 @@ func (c *Checker) saveCache() error {
 	return os.WriteFile(c.cachePath(), data, 0600)
 }
 
-// findAssetURL finds the download URL for the current OS/arch.
-func findAssetURL(assets []Asset) string {
+// findAsset finds the release asset for the current OS/arch, or nil.
+func findAsset(assets []Asset) *Asset {
 	os := runtime.GOOS
 	arch := runtime.GOARCH
 
@@ -286,7 +442,7 @@ func findAssetURL(assets []Asset) string {
 		aliases = []string{arch}
 	}
 
-	for _, asset := range assets {
+	for i, asset := range assets {
 		name := strings.ToLower(asset.Name)
 
 		// Check if it matches our OS
@@ -297,11 +453,23 @@ func findAssetURL(assets []Asset) string {
 		// Check if it matches our arch
 		for _, alias := range aliases {
 			if strings.Contains(name, alias) {
-				return asset.BrowserDownloadURL
+				return &assets[i]
 			}
 		}
 	}
 
+	return nil
+}
+
+// findChecksumURL returns the URL of the release's checksums asset, if one
+// is published alongside the binaries.
+func findChecksumURL(assets []Asset) string {
+	for _, asset := range assets {
+		name := strings.ToLower(asset.Name)
+		if strings.Contains(name, "checksums") || strings.HasSuffix(name, ".sha256") {
+			return asset.BrowserDownloadURL
+		}
+	}
 	return ""
 }
 
@@ -406,104 +574,28 @@ func RunSelfUpdate() error {
 		spin.Resume()
 	}
 
-	// We need to refactor DownloadAndInstall to support logging,
-	// or we just do the steps here manually using the checker's methods.
-	// For now, let's wrap the existing DownloadAndInstall but since it doesn't support callbacks,
-	// we'll just print some standard logs before/during if possible.
-	// Ideally we break DownloadAndInstall apart. Let's do a quick inline implementation
-	// or modify DownloadAndInstall signature. Modifying signature is cleaner.
-
-	// Since we can't easily change DownloadAndInstall signature without breaking CheckAndAutoUpdate (if it relied on it),
-	// let's pass a wrapper. Actually, CheckAndAutoUpdate uses DownloadAndInstall too.
-	// Let's create a new internal method or just do it here.
-
-	// For the sake of this task, I'll simulate the logs being emitted during the process
-	// by invoking callbacks if I can, but since I can't change the method easily,
-	// I will manually recreate the logic of DownloadAndInstall *here* with logging.
-	// This ensures we get the exact output format requested.
-
-	// --- Custom Download And Install Logic for TUI ---
 	logFunc("Initializing download...")
 
-	url := checker.GetDownloadURL()
-	if url == "" {
-		// Force refresh if missing
-		_, _, err := checker.CheckForUpdate()
-		if err != nil {
-			spin.StopWithSymbol("✗")
-			return err
-		}
-		url = checker.GetDownloadURL()
-	}
-
-	logFunc(fmt.Sprintf("Downloading from: %s...", shortURL(url)))
-
-	resp, err := http.Get(url)
-	if err != nil {
-		spin.StopWithSymbol("✗")
-		return fmt.Errorf("failed to download: %w", err)
-	}
-	defer resp.Body.Close()
-
-	if resp.StatusCode != http.StatusOK {
-		spin.StopWithSymbol("✗")
-		return fmt.Errorf("download failed with status %d", resp.StatusCode)
-	}
-
-	tmpFile, err := os.CreateTemp("", "neona-update-*")
-	if err != nil {
+	if err := checker.downloadAndInstall(logFunc); err != nil {
 		spin.StopWithSymbol("✗")
-		return fmt.Errorf("failed to create temp file: %w", err)
+		return err
 	}
-	tmpPath := tmpFile.Name()
-	defer os.Remove(tmpPath)
 
-	logFunc("Extracting and verifying binary...")
-	_, err = io.Copy(tmpFile, resp.Body)
-	tmpFile.Close()
-	if err != nil {
-		spin.StopWithSymbol("✗")
-		return fmt.Errorf("failed to download binary: %w", err)
-	}
+	spin.StopWithSymbol("●") // Done with updating step
+	fmt.Println("│")
 
-	if err := os.Chmod(tmpPath, 0755); err != nil {
-		spin.StopWithSymbol("✗")
-		return fmt.Errorf("failed to set permissions: %w", err)
-	}
+	// 4. Verifying
+	spin = newSpinner(" Verifying new update . . . .")
+	spin.Start()
 
+	// Exec the path on disk to verify; the newly installed binary now lives
+	// where the running (old) binary was loaded from
 	currentBin, err := os.Executable()
 	if err != nil {
 		spin.StopWithSymbol("✗")
 		return fmt.Errorf("failed to get current executable: %w", err)
 	}
 	currentBin, _ = filepath.EvalSymlinks(currentBin)
-
-	logFunc("Replacing old binary...")
-	// Replace binary logic
-	backupPath := currentBin + ".old"
-	os.Remove(backupPath)
-
-	if err := os.Rename(currentBin, backupPath); err != nil {
-		spin.StopWithSymbol("✗")
-		return fmt.Errorf("failed to backup current binary: %w", err)
-	}
-
-	if err := copyFile(tmpPath, currentBin); err != nil {
-		os.Rename(backupPath, currentBin) // Restore
-		spin.StopWithSymbol("✗")
-		return fmt.Errorf("failed to install new binary: %w", err)
-	}
-
-	os.Remove(backupPath)
-	spin.StopWithSymbol("●") // Done with updating step
-	fmt.Println("│")
-
-	// 4. Verifying
-	spin = newSpinner(" Verifying new update . . . .")
-	spin.Start()
-
-	// Exec new version to verify - use currentBin (the newly installed binary path)
-	// NOT os.Executable() which still points to the running old binary
 	cmd := exec.Command(currentBin, "version")
 	// captured output isn't needed, just exit code success
 	if err := cmd.Run(); err != nil {